@@ -6,12 +6,14 @@ Application::Application(const ApplicationData& appData,
                          CameraSettings& rCameraSettings,
                          GridSettings& rGridSettings,
                          GameOfLifeSettings& rGameOfLifeSettings,
-                         SimulationSettings& rSimulationSettings)
+                         SimulationSettings& rSimulationSettings,
+                         RecordingSettings& rRecordingSettings)
     : _solRenderer(_appData,
                    _solWindow,
                    _solDevice),
     _solDevice(_solWindow,
                _appData),
+    _solShaderLibrary(_solDevice),
     _solWindow(_appData.windowTitle,
                _appData.windowDimensions),
     _appData(appData),
@@ -20,6 +22,7 @@ Application::Application(const ApplicationData& appData,
     _rGridSettings(rGridSettings),
     _rGameOfLifeSettings(rGameOfLifeSettings),
     _rSimulationSettings(rSimulationSettings),
+    _rRecordingSettings(rRecordingSettings),
     _rCameraSettings(rCameraSettings)
 {
     CreateDescriptorPool();
@@ -28,11 +31,17 @@ Application::Application(const ApplicationData& appData,
     CreateGuiWindowManager();
 #endif  // !DISABLE_IM_GUI
 
+    SetupRenderSystem();
     SetupRandomNumberGenerator();
     SetupCamera();
     SetupGrid();
     SetupMarchingCubesSystem();
+    SetupVoxelMeshSystem();
+    SetupMarchingCubesComputeSystem();
+    SetupInstancedCubeSystem();
     SetupGameOfLifeSystem();
+    SetupCheckpointSystem();
+    SetupGenerationRecording();
     SetupEventCallbacks();
 }
 
@@ -58,6 +67,13 @@ void Application::Run()
         _rDiagnosticData.deltaTimeSeconds = deltaTime;
         _rDiagnosticData.totalTimeSeconds = _solClock.GetTotalTime();
 
+        const SolMemoryAllocator& rMemoryAllocator = _solDevice.GetMemoryAllocator();
+
+        _rDiagnosticData.deviceMemoryAllocatedBytes  = rMemoryAllocator.GetAllocatedBytes();
+        _rDiagnosticData.deviceMemoryUsedBytes       = rMemoryAllocator.GetUsedBytes();
+        _rDiagnosticData.deviceMemoryBlockCount      = rMemoryAllocator.GetBlockCount();
+        _rDiagnosticData.deviceMemoryAllocationCount = rMemoryAllocator.GetAllocationCount();
+
         // Start Dear ImGui frame...
         _pGuiWindowManager->NewFrame();
 #endif  // !DISABLE_IM_GUI
@@ -70,22 +86,44 @@ void Application::Run()
     vkDeviceWaitIdle(_solDevice.GetDevice());
 }
 
+bool Application::RunComputeSelfTest()
+{
+    const bool isPassed = _pGameOfLifeSystem->RunComputeSelfTest(COMPUTE_SELF_TEST_GENERATION_COUNT);
+
+    vkDeviceWaitIdle(_solDevice.GetDevice());
+
+    return isPassed;
+}
+
 void Application::Update(const float deltaTime)
 {
     Cursor&    rCursor           = Cursor::GetInstance();
-    Transform& rGameObjTransform = _pMarchingCubesSystem->GetGameObject().transform;
+    Transform& rGameObjTransform = GetMeshGameObject().transform;
 
     HandleUserInput(rGameObjTransform);
 
     _pSolCamera->LookAt(rGameObjTransform.position);
     _pSolCamera->Update(deltaTime);
 
+#if _DEBUG
+    CheckForShaderChanges(deltaTime);
+#endif  // _DEBUG
+
+    CheckForFramesInFlightChanged();
+    CheckForMeshingChanged();
+
     CheckForSimulationResetFlag();
     CheckForGridDimenionsChangedFlag();
+    CheckForCheckpointFlags();
+    CheckForRecordingFlags();
 
     if (_pSolGrid->IsGridDataValid())
     {
-        _pGameOfLifeSystem->Update(deltaTime);
+        // The recording drives the cells during playback
+        if (!_rRecordingSettings.isPlaybackEnabled)
+        {
+            _pGameOfLifeSystem->Update(deltaTime);
+        }
     }
     else
     {
@@ -101,27 +139,40 @@ void Application::Render()
 {
     const VkCommandBuffer commandBuffer = _solRenderer.BeginFrame();
 
-    if (_rRenderSettings.isRendererOutOfDate)
+    if (commandBuffer == nullptr)
     {
-        _pRenderSystem = std::make_unique<SimpleRenderSystem>(_solDevice, 
-                                                              _rRenderSettings, 
-                                                              _solRenderer.GetSwapchainRenderPass());
-
-        _rRenderSettings.isRendererOutOfDate = false;
+        return;
     }
 
-    if (commandBuffer == nullptr)
+    // Compute work can't be recorded inside the render pass
+    if (_meshingAlgorithm == MeshingAlgorithm::MARCHING_CUBES_GPU)
     {
-        return;
+        _pMarchingCubesComputeSystem->RecordMarch(commandBuffer);
     }
 
-    _solRenderer.BeginSwapchainRenderPass(commandBuffer);
+    // Draws are recorded into secondary command buffers, then executed here
+    _solRenderer.BeginSwapchainRenderPass(commandBuffer, 
+                                          VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
 
-    if (_pSolGrid->IsGridDataValid())
+    std::vector<VkCommandBuffer> secondaryCommandBuffers{};
+
+    if (_pSolGrid->IsGridDataValid() &&
+        _meshingAlgorithm == MeshingAlgorithm::MARCHING_CUBES_GPU)
+    {
+        // The GPU wrote the draw command along with the vertices
+        secondaryCommandBuffers.push_back(_pRenderSystem->RecordIndirectGameObject(*_pSolCamera, 
+                                                                                   _solRenderer,
+                                                                                   GetMeshGameObject(),
+                                                                                   _pMarchingCubesComputeSystem->GetDrawCommandBuffer(),
+                                                                                   _rDiagnosticData));
+    }
+    else if (_pSolGrid->IsGridDataValid())
     {
-        _pRenderSystem->RenderGameObject(*_pSolCamera, 
-                                         commandBuffer, 
-                                         _pMarchingCubesSystem->GetGameObject());
+        // The mesh is split into chunks, each recording thread culls a share of them into one indirect draw
+        secondaryCommandBuffers = _pRenderSystem->RecordChunkedGameObject(*_pSolCamera, 
+                                                                          _solRenderer,
+                                                                          GetMeshGameObject(),
+                                                                          _rDiagnosticData);
     }
     else
     {
@@ -130,9 +181,19 @@ void Application::Render()
 
 #ifndef DISABLE_IM_GUI
     // Render Dear ImGui...
-    _pGuiWindowManager->Render(commandBuffer);
+    // Recorded on the main thread, so it shares the main thread's command pool
+    const VkCommandBuffer guiCommandBuffer = _solRenderer.BeginSecondaryCommandBuffer(0);
+
+    _pGuiWindowManager->Render(guiCommandBuffer);
+
+    _solRenderer.EndSecondaryCommandBuffer(guiCommandBuffer);
+
+    secondaryCommandBuffers.push_back(guiCommandBuffer);
 #endif  // !DISABLE_IM_GUI
 
+    _solRenderer.ExecuteSecondaryCommandBuffers(commandBuffer, 
+                                                secondaryCommandBuffers);
+
     _solRenderer.EndSwapchainRenderPass(commandBuffer);
     _solRenderer.EndFrame();
 }
@@ -145,6 +206,14 @@ void Application::CreateDescriptorPool()
                                                                 .Build();
 }
 
+void Application::SetupRenderSystem()
+{
+    _pRenderSystem = std::make_unique<SimpleRenderSystem>(_solDevice, 
+                                                          _solShaderLibrary,
+                                                          _rRenderSettings, 
+                                                          _solRenderer.GetSwapchainRenderPass());
+}
+
 void Application::SetupRandomNumberGenerator()
 {
     RandomNumberGenerator::SetSeed(_rSimulationSettings.seed);
@@ -168,19 +237,73 @@ void Application::SetupGrid()
 void Application::SetupMarchingCubesSystem()
 {
     _pMarchingCubesSystem = std::make_unique<MarchingCubesSystem>(_solDevice, 
+                                                                  _solRenderer,
                                                                   *_pSolGrid,
+                                                                  _rRenderSettings,
                                                                   _rDiagnosticData);
 
     _pMarchingCubesSystem->March();
 }
 
+void Application::SetupVoxelMeshSystem()
+{
+    // Only meshes once it's selected
+    _pVoxelMeshSystem = std::make_unique<VoxelMeshSystem>(_solDevice, 
+                                                          _solRenderer,
+                                                          *_pSolGrid,
+                                                          _rDiagnosticData);
+}
+
+void Application::SetupMarchingCubesComputeSystem()
+{
+    // Only marches once it's selected, and only if its shader has been compiled
+    _pMarchingCubesComputeSystem = std::make_unique<MarchingCubesComputeSystem>(_solDevice,
+                                                                                _solRenderer,
+                                                                                _solShaderLibrary,
+                                                                                *_pSolGrid,
+                                                                                _rDiagnosticData);
+}
+
+void Application::SetupInstancedCubeSystem()
+{
+    // Only uploads instances once it's selected
+    _pInstancedCubeSystem = std::make_unique<InstancedCubeSystem>(_solDevice, 
+                                                                  _solRenderer,
+                                                                  *_pSolGrid,
+                                                                  _rDiagnosticData);
+}
+
 void Application::SetupGameOfLifeSystem()
 {
+    // Only used once GPU Compute is selected, and only if its shader has been compiled
+    _pGameOfLifeComputeBackend = std::make_unique<GameOfLifeComputeBackend>(_solDevice,
+                                                                            _solShaderLibrary,
+                                                                            *_pSolGrid,
+                                                                            _rGameOfLifeSettings);
+
     _pGameOfLifeSystem = std::make_unique<GameOfLifeSystem>(*_pSolGrid, 
+                                                            *_pGameOfLifeComputeBackend,
+                                                            _rGameOfLifeSettings,
+                                                            _rSimulationSettings,
+                                                            _rDiagnosticData);
+}
+
+void Application::SetupCheckpointSystem()
+{
+    _pCheckpointSystem = std::make_unique<CheckpointSystem>(*_pSolGrid,
+                                                            _rGridSettings,
                                                             _rGameOfLifeSettings,
                                                             _rSimulationSettings);
+}
+
+void Application::SetupGenerationRecording()
+{
+    _pGenerationRecorder = std::make_unique<GenerationRecorder>(*_pSolGrid,
+                                                                _rSimulationSettings);
 
-    _pGameOfLifeSystem->CheckAllCellNeighbours();
+    _pGenerationPlayer = std::make_unique<GenerationPlayer>(*_pSolGrid,
+                                                            _rGridSettings,
+                                                            _rSimulationSettings);
 }
 
 void Application::SetupEventCallbacks()
@@ -188,7 +311,13 @@ void Application::SetupEventCallbacks()
     _pGameOfLifeSystem->onUpdateAllCellStatesEvent
                       .AddListener([this]() 
                       { 
-                          _pMarchingCubesSystem->March(); 
+                          RebuildMesh(); 
+                      });
+
+    _pGameOfLifeSystem->onGenerationSteppedEvent
+                      .AddListener([this]() 
+                      { 
+                          _pGenerationRecorder->RecordGeneration(); 
                       });
 
     _rSimulationSettings.onSimulationSpeedChangedEvent
@@ -197,14 +326,6 @@ void Application::SetupEventCallbacks()
                             // Force update the next generation delay to the new value
                             _pGameOfLifeSystem->ResetNextGenerationDelayRemaining();
                         });
-
-    _rGameOfLifeSettings.onNeighbourhoodTypeChangedEvent
-                        .AddListener([this]() 
-                        {
-                            // Re-check neighbours in accordance
-                            // to new neighbourhood ruleset
-                            _pGameOfLifeSystem->CheckAllCellNeighbours();
-                        });
 }
 
 void Application::HandleUserInput(Transform& rGameObjectTransform)
@@ -241,13 +362,17 @@ void Application::CheckForSimulationResetFlag()
         return;
     }
 
+    // The new states don't follow on from the recorded ones
+    StopRecording();
+    StopPlayback();
+
     // Reset the seed to generate new values 
     // OR keep same values for repeatable simulations
     RandomNumberGenerator::SetSeed(_rSimulationSettings.seed);
 
-    _pSolGrid->Reset();                             // Reset the grid nodes and re-generate initial node states
-    _pMarchingCubesSystem->March();                 // Create the reset vertices
-    _pGameOfLifeSystem->CheckAllCellNeighbours();   // Retrieve the next generation state
+    _pSolGrid->Reset();                 // Reset the grid nodes and re-generate initial node states
+    _pGameOfLifeSystem->MarkCellStatesEdited();
+    RebuildMesh();                      // Create the reset vertices
 
     // Finished!
     _rSimulationSettings.isSimulationResetRequested = false;
@@ -260,19 +385,265 @@ void Application::CheckForGridDimenionsChangedFlag()
         return;
     }
 
+    // Recordings are tied to the grid dimensions they were made with
+    StopRecording();
+    StopPlayback();
+
     // Reset the seed to generate new values 
     // OR keep same values for repeatable simulations
     RandomNumberGenerator::SetSeed(_rSimulationSettings.seed);
 
     _pSolGrid->Initialise();                                // Re-initialise the Grid
-    _pMarchingCubesSystem->ResetVerticesContainerSize();    // Shrink vertex container to free up wasted memory
-    _pMarchingCubesSystem->March();                         // Create the new vertices
-    _pGameOfLifeSystem->CheckAllCellNeighbours();           // Retrieve the next generation state
+    _pGameOfLifeSystem->MarkCellStatesEdited();
+    ResetMeshVerticesContainerSize();                       // Shrink vertex container to free up wasted memory
+    RebuildMesh();                                          // Create the new vertices
 
     // Finished!
     _rGridSettings.isGridDimensionsChangeRequested = false;
 }
 
+void Application::CheckForCheckpointFlags()
+{
+    if (_rSimulationSettings.isCheckpointSaveRequested)
+    {
+        _pCheckpointSystem->SaveAsync(CheckpointSystem::CHECKPOINT_FILE_PATH);
+
+        // Finished!
+        _rSimulationSettings.isCheckpointSaveRequested = false;
+    }
+
+    if (!_rSimulationSettings.isCheckpointLoadRequested)
+    {
+        return;
+    }
+
+    const glm::uvec3 previousDimensions = _rGridSettings.dimensions;
+
+    StopRecording();
+    StopPlayback();
+
+    if (_pCheckpointSystem->Load(CheckpointSystem::CHECKPOINT_FILE_PATH))
+    {
+        if (_rGridSettings.dimensions != previousDimensions)
+        {
+            ResetMeshVerticesContainerSize();                       // Shrink vertex container to free up wasted memory
+        }
+
+        RebuildMesh();                                              // Create the restored vertices
+        _pGameOfLifeSystem->MarkCellStatesEdited();
+        _pGameOfLifeSystem->ResetNextGenerationDelayRemaining();
+
+        _rSimulationSettings.onSimulationRestoredEvent.Invoke();
+    }
+
+    // Finished!
+    _rSimulationSettings.isCheckpointLoadRequested = false;
+}
+
+void Application::CheckForRecordingFlags()
+{
+    // The recorder stops itself if a write fails
+    _rRecordingSettings.isRecording = _pGenerationRecorder->IsRecording();
+
+    if (_rRecordingSettings.isRecordingToggleRequested)
+    {
+        if (_rRecordingSettings.isRecording)
+        {
+            StopRecording();
+        }
+        else if (!_rRecordingSettings.isPlaybackEnabled)
+        {
+            _rRecordingSettings.isRecording = _pGenerationRecorder->Start(GenerationRecorder::RECORDING_FILE_PATH,
+                                                                          _rRecordingSettings.keyframeInterval);
+        }
+
+        // Finished!
+        _rRecordingSettings.isRecordingToggleRequested = false;
+    }
+
+    // Recordings need every generation on the CPU
+    _pGameOfLifeSystem->SetEveryGenerationRequired(_rRecordingSettings.isRecording);
+
+    if (_rRecordingSettings.isPlaybackToggleRequested)
+    {
+        const glm::uvec3 previousDimensions = _rGridSettings.dimensions;
+
+        if (_rRecordingSettings.isPlaybackEnabled)
+        {
+            StopPlayback();
+        }
+        else if (!_rRecordingSettings.isRecording && 
+                 _pGenerationPlayer->Open(GenerationRecorder::RECORDING_FILE_PATH))
+        {
+            _rRecordingSettings.isPlaybackEnabled       = true;
+            _rRecordingSettings.firstRecordedGeneration = _pGenerationPlayer->GetFirstGeneration();
+            _rRecordingSettings.lastRecordedGeneration  = _pGenerationPlayer->GetLastGeneration();
+            _rRecordingSettings.playbackGeneration      = _rRecordingSettings.firstRecordedGeneration;
+            _rRecordingSettings.isPlaybackSeekRequested = true;
+
+            if (_rGridSettings.dimensions != previousDimensions)
+            {
+                ResetMeshVerticesContainerSize();                       // Shrink vertex container to free up wasted memory
+                _rSimulationSettings.onSimulationRestoredEvent.Invoke();
+            }
+        }
+
+        // Finished!
+        _rRecordingSettings.isPlaybackToggleRequested = false;
+    }
+
+    if (!_rRecordingSettings.isPlaybackSeekRequested)
+    {
+        return;
+    }
+
+    if (_rRecordingSettings.isPlaybackEnabled && 
+        _pGenerationPlayer->Seek(_rRecordingSettings.playbackGeneration))
+    {
+        RebuildMesh();                      // Create the recorded vertices
+        _pGameOfLifeSystem->MarkCellStatesEdited();
+    }
+
+    // Finished!
+    _rRecordingSettings.isPlaybackSeekRequested = false;
+}
+
+void Application::CheckForShaderChanges(const float deltaTime)
+{
+    _shaderReloadPollTimeRemaining -= deltaTime;
+
+    if (_shaderReloadPollTimeRemaining > 0.f)
+    {
+        return;
+    }
+
+    _shaderReloadPollTimeRemaining = SHADER_RELOAD_POLL_TIME;
+
+    std::vector<VkShaderModule> staleShaderModules{};
+
+    if (_solShaderLibrary.ReloadChangedShaders(staleShaderModules))
+    {
+        // Pipelines bake in their shaders, so rebuild them all once the GPU has finished with the old ones
+        vkDeviceWaitIdle(_solDevice.GetDevice());
+
+        // Replacing the render system waits for the old one's background pipeline builds
+        SetupRenderSystem();
+        _pGameOfLifeComputeBackend->RebuildPipeline();
+        _pMarchingCubesComputeSystem->RebuildPipeline();
+    }
+
+    // Nothing can be building from the old modules now
+    _solShaderLibrary.DestroyShaderModules(staleShaderModules);
+}
+
+void Application::CheckForFramesInFlightChanged()
+{
+    if (_rRenderSettings.framesInFlight == _solRenderer.GetFramesInFlight())
+    {
+        return;
+    }
+
+    _solRenderer.SetFramesInFlight(_rRenderSettings.framesInFlight);
+    _rRenderSettings.framesInFlight = _solRenderer.GetFramesInFlight();   // Reflect any clamping
+}
+
+void Application::CheckForMeshingChanged()
+{
+    if (_rRenderSettings.meshingAlgorithm == MeshingAlgorithm::MARCHING_CUBES_GPU &&
+        !_pMarchingCubesComputeSystem->IsAvailable())
+    {
+        // Without the compute shader, march on the CPU instead
+        _rRenderSettings.meshingAlgorithm = MeshingAlgorithm::MARCHING_CUBES;
+    }
+
+    if (_rRenderSettings.meshingAlgorithm == MeshingAlgorithm::INSTANCED_CUBES &&
+        !_pRenderSystem->IsCubeInstanceShaderAvailable())
+    {
+        // Without the instanced vertex shader, mesh the surface instead
+        _rRenderSettings.meshingAlgorithm = MeshingAlgorithm::MARCHING_CUBES;
+    }
+
+    const bool isIsoSurfaceChanged = _rRenderSettings.meshingAlgorithm == MeshingAlgorithm::MARCHING_CUBES &&
+                                     _rRenderSettings.isoSurfaceType != _pMarchingCubesSystem->GetIsoSurfaceType();
+
+    if (_rRenderSettings.meshingAlgorithm == _meshingAlgorithm && 
+        !isIsoSurfaceChanged)
+    {
+        return;
+    }
+
+    // Each mesh has its own game object, so carry the user's rotation across
+    const Transform transform = GetMeshGameObject().transform;
+
+    // Rebuild from the current cells, the simulation may be paused
+    RebuildMesh();
+
+    GetMeshGameObject().transform = transform;
+}
+
+void Application::RebuildMesh()
+{
+    _meshingAlgorithm = _rRenderSettings.meshingAlgorithm;
+
+    if (_meshingAlgorithm == MeshingAlgorithm::GREEDY_VOXELS)
+    {
+        _pVoxelMeshSystem->Mesh();
+    }
+    else if (_meshingAlgorithm == MeshingAlgorithm::MARCHING_CUBES_GPU)
+    {
+        _pMarchingCubesComputeSystem->March();     // Recorded into the next frame
+    }
+    else if (_meshingAlgorithm == MeshingAlgorithm::INSTANCED_CUBES)
+    {
+        _pInstancedCubeSystem->UpdateInstances();
+    }
+    else
+    {
+        _pMarchingCubesSystem->March();
+    }
+}
+
+void Application::ResetMeshVerticesContainerSize()
+{
+    _pMarchingCubesSystem->ResetVerticesContainerSize();
+    _pVoxelMeshSystem->ResetVerticesContainerSize();
+    _pMarchingCubesComputeSystem->ResetVerticesContainerSize();
+    _pInstancedCubeSystem->ResetVerticesContainerSize();
+}
+
+SolGameObject& Application::GetMeshGameObject()
+{
+    if (_meshingAlgorithm == MeshingAlgorithm::GREEDY_VOXELS)
+    {
+        return _pVoxelMeshSystem->GetGameObject();
+    }
+
+    if (_meshingAlgorithm == MeshingAlgorithm::MARCHING_CUBES_GPU)
+    {
+        return _pMarchingCubesComputeSystem->GetGameObject();
+    }
+
+    if (_meshingAlgorithm == MeshingAlgorithm::INSTANCED_CUBES)
+    {
+        return _pInstancedCubeSystem->GetGameObject();
+    }
+
+    return _pMarchingCubesSystem->GetGameObject();
+}
+
+void Application::StopRecording()
+{
+    _pGenerationRecorder->Stop();
+    _rRecordingSettings.isRecording = false;
+}
+
+void Application::StopPlayback()
+{
+    // The grid is left as the last shown generation, so the simulation carries on from there
+    _pGenerationPlayer->Close();
+    _rRecordingSettings.isPlaybackEnabled = false;
+}
+
 #ifndef DISABLE_IM_GUI
 void Application::CreateGuiWindowManager()
 {
@@ -10,7 +10,14 @@
 #include "GuiWindowManager.hpp"
 #include "SolGrid.hpp"
 #include "MarchingCubesSystem.hpp"
+#include "VoxelMeshSystem.hpp"
+#include "MarchingCubesComputeSystem.hpp"
+#include "InstancedCubeSystem.hpp"
 #include "GameOfLifeSystem.hpp"
+#include "CheckpointSystem.hpp"
+#include "GenerationRecorder.hpp"
+#include "GenerationPlayer.hpp"
+#include "RecordingSettings.hpp"
 #include "CameraController.hpp"
 
 using namespace SolEngine;
@@ -26,31 +33,61 @@ public:
     Application() = delete;
     Application(const ApplicationData& appData, DiagnosticData& rDiagnosticData,
                 RenderSettings& rRenderSettings, CameraSettings& rCameraSettings, GridSettings& rGridSettings, 
-                GameOfLifeSettings& rGameOfLifeSettings, SimulationSettings& rSimulationSettings);
+                GameOfLifeSettings& rGameOfLifeSettings, SimulationSettings& rSimulationSettings, RecordingSettings& rRecordingSettings);
     ~Application();
         
     void Run();
 
+    /// <summary>
+    /// Steps the same generations on the CPU and with GPU Compute and compares them, without opening the main loop.
+    /// </summary>
+    /// <returns>True if they matched.</returns>
+    bool RunComputeSelfTest();
+
 private:
     static constexpr float CAMERA_MOVE_SPEED{ 1.5f };
     static constexpr float GAME_OBJECT_ROT_SPEED{ glm::radians(.5f) };
+    static constexpr float SHADER_RELOAD_POLL_TIME{ 1.f };  // Seconds between checking shader files for changes (Debug only)
+    static constexpr uint32_t COMPUTE_SELF_TEST_GENERATION_COUNT{ 64U };
+
     // Inherited via IMonoBehaviour
     virtual void Update(const float deltaTime) override;
     void Render();
 
     void CreateDescriptorPool();
 
+    void SetupRenderSystem();
     void SetupRandomNumberGenerator();
     void SetupCamera();
     void SetupGrid();
     void SetupMarchingCubesSystem();
+    void SetupVoxelMeshSystem();
+    void SetupMarchingCubesComputeSystem();
+    void SetupInstancedCubeSystem();
     void SetupGameOfLifeSystem();
+    void SetupCheckpointSystem();
+    void SetupGenerationRecording();
     void SetupEventCallbacks();
 
     void HandleUserInput(Transform& rGameObjectTransform);
 
     void CheckForSimulationResetFlag();
     void CheckForGridDimenionsChangedFlag();
+    void CheckForCheckpointFlags();
+    void CheckForRecordingFlags();
+    void CheckForShaderChanges(const float deltaTime);
+    void CheckForFramesInFlightChanged();
+    void CheckForMeshingChanged();
+
+    /// <summary>
+    /// Meshes the current cells with the selected Meshing Algorithm.
+    /// </summary>
+    void           RebuildMesh();
+    void           ResetMeshVerticesContainerSize();
+    SolGameObject& GetMeshGameObject();
+
+    void StopRecording();
+    void StopPlayback();
 
 #ifndef DISABLE_IM_GUI
     void CreateGuiWindowManager();
@@ -63,11 +100,17 @@ private:
     GridSettings&       _rGridSettings;
     GameOfLifeSettings& _rGameOfLifeSettings;
     SimulationSettings& _rSimulationSettings;
+    RecordingSettings&  _rRecordingSettings;
+
+    float _shaderReloadPollTimeRemaining{ SHADER_RELOAD_POLL_TIME };
+
+    MeshingAlgorithm _meshingAlgorithm{ MeshingAlgorithm::MARCHING_CUBES };   // Of the current mesh
 
-    SolClock    _solClock;
-    SolWindow   _solWindow;
-    SolDevice   _solDevice;
-    SolRenderer _solRenderer;
+    SolClock         _solClock;
+    SolWindow        _solWindow;
+    SolDevice        _solDevice;
+    SolRenderer      _solRenderer;
+    SolShaderLibrary _solShaderLibrary;
 
     std::unique_ptr<SolDescriptorPool> _pSolDescriptorPool;
 
@@ -75,9 +118,16 @@ private:
     std::unique_ptr<GuiWindowManager>  _pGuiWindowManager;
 #endif  // !DISABLE_IM_GUI
 
-    std::unique_ptr<SolCamera>           _pSolCamera          { nullptr };
-    std::unique_ptr<SolGrid>             _pSolGrid            { nullptr };
-    std::unique_ptr<SimpleRenderSystem>  _pRenderSystem       { nullptr };
-    std::unique_ptr<MarchingCubesSystem> _pMarchingCubesSystem{ nullptr };
-    std::unique_ptr<GameOfLifeSystem>    _pGameOfLifeSystem   { nullptr };
+    std::unique_ptr<SolCamera>                  _pSolCamera                 { nullptr };
+    std::unique_ptr<SolGrid>                    _pSolGrid                   { nullptr };
+    std::unique_ptr<SimpleRenderSystem>         _pRenderSystem              { nullptr };
+    std::unique_ptr<MarchingCubesSystem>        _pMarchingCubesSystem       { nullptr };
+    std::unique_ptr<VoxelMeshSystem>            _pVoxelMeshSystem           { nullptr };
+    std::unique_ptr<MarchingCubesComputeSystem> _pMarchingCubesComputeSystem{ nullptr };
+    std::unique_ptr<InstancedCubeSystem>        _pInstancedCubeSystem       { nullptr };
+    std::unique_ptr<GameOfLifeComputeBackend>   _pGameOfLifeComputeBackend  { nullptr };
+    std::unique_ptr<GameOfLifeSystem>           _pGameOfLifeSystem          { nullptr };
+    std::unique_ptr<CheckpointSystem>           _pCheckpointSystem          { nullptr };
+    std::unique_ptr<GenerationRecorder>         _pGenerationRecorder        { nullptr };
+    std::unique_ptr<GenerationPlayer>           _pGenerationPlayer          { nullptr };
 };
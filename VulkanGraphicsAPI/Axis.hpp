@@ -1,12 +0,0 @@
-#pragma once
-
-namespace SolEngine::Enumeration
-{
-    enum class Axis
-    {
-        UNKNOWN = -1,
-        X,
-        Y,
-        Z
-    };
-}
\ No newline at end of file
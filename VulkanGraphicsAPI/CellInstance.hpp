@@ -0,0 +1,59 @@
+#pragma once
+#include "Constants.hpp"
+
+namespace SolEngine::Data
+{
+	/// <summary>
+	/// A live cell for a cube to be drawn at, read per instance alongside the cube's vertices.
+	/// Only its grid indices are packed, into 4 bytes, CubeInstanceShader works out its position and colour from them.
+	/// </summary>
+	struct CellInstance
+	{
+		static constexpr uint32_t BINDING{ 1U };	// After the Vertex binding
+
+		CellInstance() = default;
+
+		CellInstance(const glm::uvec3& indices)
+			: cellIndices(indices, 0)
+		{}
+
+		static std::vector<VkVertexInputBindingDescription> InputBindingDescriptors()
+		{
+			std::vector<VkVertexInputBindingDescription> vertexInputBindingDescriptions(1);
+
+			vertexInputBindingDescriptions.at(0) =
+			{
+				VkVertexInputBindingDescription
+				{
+					.binding   = BINDING,
+					.stride    = sizeof(CellInstance),
+					.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE
+				}
+			};
+
+			return vertexInputBindingDescriptions;
+		}
+
+		static std::vector<VkVertexInputAttributeDescription> InputAttributeDescriptions()
+		{
+			std::vector<VkVertexInputAttributeDescription> vertexInputAttributeDescriptions(1);
+
+			vertexInputAttributeDescriptions.at(0) =
+			{
+				VkVertexInputAttributeDescription	// Cell Indices, follows Vertex's attributes
+				{
+					.location = 3,
+					.binding  = BINDING,
+					.format   = VK_FORMAT_R8G8B8A8_UINT,	// X, Y, Z, (Padding)
+					.offset   = offsetof(CellInstance, cellIndices)
+				}
+			};
+
+			return vertexInputAttributeDescriptions;
+		}
+
+		glm::u8vec4 cellIndices{ 0, 0, 0, 0 };
+	};
+
+	static_assert(MAX_CELLS_PER_AXIS_COUNT <= 256U, "CellInstance indices must fit in a byte!");
+}
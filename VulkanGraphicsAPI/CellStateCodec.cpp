@@ -0,0 +1,156 @@
+#include "CellStateCodec.hpp"
+
+namespace Utility
+{
+	void CellStateCodec::PackStates(const bool* pStates, 
+									const size_t cellCount, 
+									uint8_t* pOutPackedStates)
+	{
+		const size_t fullByteCount = cellCount / 8U;
+
+		for (size_t byteIndex = 0; byteIndex < fullByteCount; ++byteIndex)
+		{
+			const bool* pByteStates = pStates + (byteIndex * 8U);
+			uint8_t     packedByte(0U);
+
+			for (uint32_t bit = 0; bit < 8U; ++bit)
+			{
+				packedByte |= (uint8_t)(pByteStates[bit] << bit);
+			}
+
+			pOutPackedStates[byteIndex] = packedByte;
+		}
+
+		// Left over states that don't fill a whole byte
+		const size_t remainingCount = cellCount - (fullByteCount * 8U);
+
+		if (remainingCount == 0U)
+		{
+			return;
+		}
+
+		uint8_t packedByte(0U);
+
+		for (uint32_t bit = 0; bit < remainingCount; ++bit)
+		{
+			packedByte |= (uint8_t)(pStates[(fullByteCount * 8U) + bit] << bit);
+		}
+
+		pOutPackedStates[fullByteCount] = packedByte;
+	}
+
+	void CellStateCodec::UnpackStates(const uint8_t* pPackedStates, 
+									  const size_t cellCount, 
+									  bool* pOutStates)
+	{
+		for (size_t i = 0; i < cellCount; ++i)
+		{
+			pOutStates[i] = (pPackedStates[i / 8U] >> (i % 8U)) & 1U;
+		}
+	}
+
+	size_t CellStateCodec::Compress(const uint8_t* pSource, 
+									const size_t sourceSizeBytes, 
+									std::vector<uint8_t>& rOutCompressed)
+	{
+		const size_t startSizeBytes = rOutCompressed.size();
+		size_t       i(0U);
+
+		while (i < sourceSizeBytes)
+		{
+			// Measure the run of repeated bytes starting here
+			size_t runLength(1U);
+
+			while (i + runLength < sourceSizeBytes && 
+				   runLength < MAX_RUN_LENGTH && 
+				   pSource[i + runLength] == pSource[i])
+			{
+				++runLength;
+			}
+
+			// Run - Header of 257 - length, followed by the repeated byte
+			if (runLength >= MIN_RUN_LENGTH)
+			{
+				rOutCompressed.push_back((uint8_t)(257U - runLength));
+				rOutCompressed.push_back(pSource[i]);
+
+				i += runLength;
+
+				continue;
+			}
+
+			// Literal - Header of length - 1, followed by the bytes as-is. 
+			// Keep going until a run worth encoding starts.
+			const size_t literalStart = i;
+			size_t       literalLength(0U);
+
+			while (i < sourceSizeBytes && literalLength < MAX_LITERAL_LENGTH)
+			{
+				if (i + 2U < sourceSizeBytes && 
+					pSource[i] == pSource[i + 1U] && 
+					pSource[i] == pSource[i + 2U])
+				{
+					break;
+				}
+
+				++i;
+				++literalLength;
+			}
+
+			rOutCompressed.push_back((uint8_t)(literalLength - 1U));
+			rOutCompressed.insert(rOutCompressed.end(), 
+								  pSource + literalStart, 
+								  pSource + literalStart + literalLength);
+		}
+
+		return rOutCompressed.size() - startSizeBytes;
+	}
+
+	bool CellStateCodec::Decompress(const uint8_t* pCompressed, 
+									const size_t compressedSizeBytes, 
+									uint8_t* pOutDestination, 
+									const size_t destinationSizeBytes)
+	{
+		size_t readIndex (0U);
+		size_t writeIndex(0U);
+
+		while (readIndex < compressedSizeBytes)
+		{
+			const uint8_t header = pCompressed[readIndex++];
+
+			// Literal
+			if (header < 128U)
+			{
+				const size_t literalLength = header + 1U;
+
+				if (readIndex + literalLength > compressedSizeBytes || 
+					writeIndex + literalLength > destinationSizeBytes)
+				{
+					return false;
+				}
+
+				memcpy(pOutDestination + writeIndex, pCompressed + readIndex, literalLength);
+
+				readIndex  += literalLength;
+				writeIndex += literalLength;
+
+				continue;
+			}
+
+			// Run
+			const size_t runLength = 257U - header;
+
+			if (readIndex >= compressedSizeBytes || 
+				writeIndex + runLength > destinationSizeBytes)
+			{
+				return false;
+			}
+
+			memset(pOutDestination + writeIndex, pCompressed[readIndex++], runLength);
+
+			writeIndex += runLength;
+		}
+
+		return writeIndex == destinationSizeBytes;
+	}
+}
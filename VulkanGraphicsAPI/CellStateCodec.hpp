@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Utility
+{
+	/// <summary>
+	/// Converts cell states to and from a compact on-disk representation.
+	/// States are bit-packed (least significant bit first) and then run-length encoded with PackBits,
+	/// which collapses the long runs of empty or full bytes found in most grids.
+	/// </summary>
+	class CellStateCodec
+	{
+	public:
+		static size_t GetPackedSizeBytes(const size_t cellCount) { return (cellCount + 7U) / 8U; }
+
+		/// <summary>
+		/// Packs 8 cell states into each byte.
+		/// </summary>
+		static void PackStates(const bool* pStates, const size_t cellCount, uint8_t* pOutPackedStates);
+
+		/// <summary>
+		/// Expands bit-packed states back into one bool per cell.
+		/// </summary>
+		static void UnpackStates(const uint8_t* pPackedStates, const size_t cellCount, bool* pOutStates);
+
+		/// <summary>
+		/// Appends the PackBits encoding of the source bytes to rOutCompressed.
+		/// </summary>
+		/// <returns>Bytes appended.</returns>
+		static size_t Compress(const uint8_t* pSource, const size_t sourceSizeBytes, std::vector<uint8_t>& rOutCompressed);
+
+		/// <summary>
+		/// Decodes exactly destinationSizeBytes bytes.
+		/// </summary>
+		/// <returns>False if the compressed data is malformed or doesn't fill the destination exactly.</returns>
+		static bool Decompress(const uint8_t* pCompressed, const size_t compressedSizeBytes, uint8_t* pOutDestination, const size_t destinationSizeBytes);
+
+	private:
+		static constexpr size_t MIN_RUN_LENGTH    { 3U };	// Runs shorter than this are cheaper as literals
+		static constexpr size_t MAX_RUN_LENGTH    { 129U };
+		static constexpr size_t MAX_LITERAL_LENGTH{ 128U };
+	};
+}
@@ -1,4 +1,6 @@
 #pragma once
+#include <utility>
+
 #include "Constants.hpp"
 #include "DiagnosticData.hpp"
 
@@ -18,38 +20,34 @@ namespace SolEngine::DOD
         size_t AllocateDataArrays()
         {
             // Malloc alignments
-            const size_t intAlign           { 4U };
-            const size_t boolAlign          { 1U };
-            const size_t neighbourStateAlign{ 1U };
+            const size_t boolAlign{ 1U };
 
             size_t memoryAllocatedBytes(0);
 
-            memoryAllocatedBytes += AlignedMallocContiguous2DArray(pXVertices, MAX_CELLS_PER_AXIS_COUNT, CUBE_VERTEX_COUNT, intAlign);
-            memoryAllocatedBytes += AlignedMallocContiguous2DArray(pYVertices, MAX_CELLS_PER_AXIS_COUNT, CUBE_VERTEX_COUNT, intAlign);
-            memoryAllocatedBytes += AlignedMallocContiguous2DArray(pZVertices, MAX_CELLS_PER_AXIS_COUNT, CUBE_VERTEX_COUNT, intAlign);
-
-            memoryAllocatedBytes += AlignedMallocContiguousArray(pCellStates,          MAX_CELLS_VERTEX_COUNT, boolAlign);
-            memoryAllocatedBytes += AlignedMallocContiguousArray(pLiveNeighbourCounts, MAX_CELLS_VERTEX_COUNT, neighbourStateAlign);
+            memoryAllocatedBytes += AlignedMallocContiguousArray(pCellStates,     MAX_CELLS_VERTEX_COUNT, boolAlign);
+            memoryAllocatedBytes += AlignedMallocContiguousArray(pNextCellStates, MAX_CELLS_VERTEX_COUNT, boolAlign);
 
             return memoryAllocatedBytes;
         }
 
         void Free()
         {
-            FreeAlignedMallocArray(pXVertices);             // X-Positions
-            FreeAlignedMallocArray(pYVertices);             // Y-Positions
-            FreeAlignedMallocArray(pZVertices);             // Z-Positions
             FreeAlignedMallocArray(pCellStates);            // Cell States
-            FreeAlignedMallocArray(pLiveNeighbourCounts);   // Live Neighbours
+            FreeAlignedMallocArray(pNextCellStates);        // Next Generation Cell States
 
             _wasFreed = true;
         }
 
-        int*              pXVertices          { nullptr }; // All cubes vertices along x-axis [position_index * CUBE_VERTEX_COUNT + vertex_index]
-        int*              pYVertices          { nullptr }; // All cubes vertices along y-axis [position_index * CUBE_VERTEX_COUNT + vertex_index]
-        int*              pZVertices          { nullptr }; // All cubes vertices along z-axis [position_index * CUBE_VERTEX_COUNT + vertex_index]
+        /// <summary>
+        /// Flips the double buffered cell states, so the next generation becomes the current one.
+        /// </summary>
+        void SwapCellStates()
+        {
+            std::swap(pCellStates, pNextCellStates);
+        }
+
         bool*             pCellStates         { nullptr }; // Stores all cell states (false = dead, true = alive)
-        NeighbourCount_t* pLiveNeighbourCounts{ nullptr }; // Stores all live neighbours relative to the node
+        bool*             pNextCellStates     { nullptr }; // Back buffer the next generation is written into, swapped with pCellStates each step
 
     private:
         bool _wasFreed{ false };    // Memory leak flag
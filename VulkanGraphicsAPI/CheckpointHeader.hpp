@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+
+namespace SolEngine::Data
+{
+	/// <summary>
+	/// Start of a checkpoint file. It is followed by blockCount compressed block sizes (uint32_t), then the blocks themselves.
+	/// Each block holds up to blockSizeBytes of bit-packed cell states, compressed independently so blocks can be decoded in parallel.
+	/// </summary>
+	struct CheckpointHeader
+	{
+		static constexpr uint32_t MAGIC  { 0x50434C53 };	// "SLCP"
+		static constexpr uint32_t VERSION{ 1U };
+
+		uint32_t magic	 { MAGIC };
+		uint32_t version { VERSION };
+
+		// Grid
+		uint32_t dimensions[3]  { 0U };
+		float	 liveCellDensity{ 0.f };
+
+		// Rules
+		uint8_t neighbourhoodType	{ 0U };
+		uint8_t underpopulationCount{ 0U };
+		uint8_t overpopulationCount { 0U };
+		uint8_t reproductionCount	{ 0U };
+
+		// Simulation
+		int32_t	 seed		{ 0 };
+		uint64_t generation { 0U };
+
+		// Cell data
+		uint64_t cellCount	   { 0U };
+		uint32_t blockSizeBytes{ 0U };
+		uint32_t blockCount	   { 0U };
+	};
+}
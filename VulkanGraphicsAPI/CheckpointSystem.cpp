@@ -0,0 +1,294 @@
+#include "CheckpointSystem.hpp"
+
+namespace SolEngine::System
+{
+    CheckpointSystem::CheckpointSystem(SolGrid& rSolGrid, 
+                                       GridSettings& rGridSettings,
+                                       GameOfLifeSettings& rGameOfLifeSettings,
+                                       SimulationSettings& rSimulationSettings)
+        : _rSolGrid(rSolGrid),
+          _rGridSettings(rGridSettings),
+          _rGameOfLifeSettings(rGameOfLifeSettings),
+          _rSimulationSettings(rSimulationSettings)
+    {}
+
+    CheckpointSystem::~CheckpointSystem()
+    {
+        // Don't leave a half written checkpoint behind
+        WaitForPendingSave();
+    }
+
+    void CheckpointSystem::SaveAsync(const std::string& filePath)
+    {
+        WaitForPendingSave();
+
+        const glm::uvec3 gridDimensions = _rSolGrid.GetDimensions();
+        const size_t     cellCount      = _rGridSettings.GetNodeCount();
+        const size_t     packedSize     = CellStateCodec::GetPackedSizeBytes(cellCount);
+
+        CheckpointHeader header
+        {
+            .dimensions           = { gridDimensions.x, gridDimensions.y, gridDimensions.z },
+            .liveCellDensity      = _rGridSettings.liveCellDensity,
+            .neighbourhoodType    = (uint8_t)_rGameOfLifeSettings.neighbourhoodType,
+            .underpopulationCount = _rGameOfLifeSettings.underpopulationCount,
+            .overpopulationCount  = _rGameOfLifeSettings.overpopulationCount,
+            .reproductionCount    = _rGameOfLifeSettings.reproductionCount,
+            .seed                 = _rSimulationSettings.seed,
+            .generation           = _rSimulationSettings.generation,
+            .cellCount            = cellCount,
+            .blockSizeBytes       = BLOCK_SIZE_BYTES,
+            .blockCount           = (uint32_t)((packedSize + BLOCK_SIZE_BYTES - 1U) / BLOCK_SIZE_BYTES)
+        };
+
+        // Packing is the only part that has to see the live cells, 
+        // compression and disk I/O happen off the main thread
+        std::vector<uint8_t> packedStates(packedSize);
+        CellStateCodec::PackStates(_rSolGrid.cells.pCellStates, cellCount, packedStates.data());
+
+        _pendingSave = std::async(std::launch::async, 
+                                  [filePath, header, packedStates = std::move(packedStates)]()
+                                  {
+                                      return WriteCheckpoint(filePath, header, packedStates);
+                                  });
+    }
+
+    bool CheckpointSystem::Load(const std::string& filePath)
+    {
+        // Make sure we aren't reading a file that is still being written
+        WaitForPendingSave();
+
+        const SolMappedFile mappedFile(filePath);
+
+        if (!mappedFile.IsValid() || mappedFile.GetSize() < sizeof(CheckpointHeader))
+        {
+            return false;
+        }
+
+        const uint8_t*   pFileData = mappedFile.GetData();
+        CheckpointHeader header{};
+
+        memcpy(&header, pFileData, sizeof(CheckpointHeader));
+
+        if (!IsHeaderValid(header))
+        {
+            printf_s("Checkpoint has an invalid header: %s\n", filePath.c_str());
+
+            return false;
+        }
+
+        const size_t    packedSize       = CellStateCodec::GetPackedSizeBytes(header.cellCount);
+        const size_t    blockTableOffset = sizeof(CheckpointHeader);
+        const size_t    blockDataOffset  = blockTableOffset + (header.blockCount * sizeof(uint32_t));
+        const uint32_t* pBlockSizes      = (const uint32_t*)(pFileData + blockTableOffset);
+
+        if (mappedFile.GetSize() < blockDataOffset)
+        {
+            return false;
+        }
+
+        // Work out where each block starts so they can be decoded in any order
+        std::vector<size_t> blockOffsets(header.blockCount);
+        size_t              blockOffset(blockDataOffset);
+
+        for (uint32_t i = 0; i < header.blockCount; ++i)
+        {
+            blockOffsets[i] = blockOffset;
+            blockOffset    += pBlockSizes[i];
+        }
+
+        if (mappedFile.GetSize() < blockOffset)
+        {
+            printf_s("Checkpoint is truncated: %s\n", filePath.c_str());
+
+            return false;
+        }
+
+        // Decode into a scratch buffer first, so a corrupt file can't leave the grid half loaded
+        std::vector<uint8_t>  packedStates(packedSize);
+        std::vector<uint32_t> blockIndices(header.blockCount);
+        std::atomic<bool>     areAllBlocksValid(true);
+
+        std::iota(blockIndices.begin(), blockIndices.end(), 0U);
+
+        std::for_each(std::execution::par, 
+                      blockIndices.begin(), 
+                      blockIndices.end(), 
+                      [&](const uint32_t blockIndex)
+                      {
+                          const size_t firstByte = (size_t)blockIndex * header.blockSizeBytes;
+                          const size_t byteCount = std::min<size_t>(header.blockSizeBytes, packedSize - firstByte);
+
+                          if (!CellStateCodec::Decompress(pFileData + blockOffsets[blockIndex], 
+                                                          pBlockSizes[blockIndex], 
+                                                          packedStates.data() + firstByte, 
+                                                          byteCount))
+                          {
+                              areAllBlocksValid = false;
+                          }
+                      });
+
+        if (!areAllBlocksValid)
+        {
+            printf_s("Checkpoint has corrupt cell data: %s\n", filePath.c_str());
+
+            return false;
+        }
+
+        const glm::uvec3 dimensions(header.dimensions[0], 
+                                    header.dimensions[1], 
+                                    header.dimensions[2]);
+
+        // Rules
+        _rGameOfLifeSettings.neighbourhoodType    = (NeighbourhoodType)header.neighbourhoodType;
+        _rGameOfLifeSettings.underpopulationCount = header.underpopulationCount;
+        _rGameOfLifeSettings.overpopulationCount  = header.overpopulationCount;
+        _rGameOfLifeSettings.reproductionCount    = header.reproductionCount;
+
+        // Simulation
+        _rSimulationSettings.seed       = header.seed;
+        _rSimulationSettings.generation = header.generation;
+        RandomNumberGenerator::SetSeed(header.seed);
+
+        // Grid - only rebuild it when the size actually changes
+        _rGridSettings.liveCellDensity = header.liveCellDensity;
+
+        if (_rGridSettings.dimensions != dimensions)
+        {
+            _rGridSettings.dimensions = dimensions;
+            _rSolGrid.Initialise();
+        }
+
+        CellStateCodec::UnpackStates(packedStates.data(), 
+                                     header.cellCount, 
+                                     _rSolGrid.cells.pCellStates);
+
+        printf_s("Loaded checkpoint at generation %llu: %s\n", header.generation, filePath.c_str());
+
+        return true;
+    }
+
+    bool CheckpointSystem::IsSaving() const
+    {
+        return _pendingSave.valid() && 
+               _pendingSave.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+    }
+
+    bool CheckpointSystem::WriteCheckpoint(const std::string& filePath, 
+                                           const CheckpointHeader& header, 
+                                           const std::vector<uint8_t>& packedStates)
+    {
+        // Compress every block in parallel
+        std::vector<std::vector<uint8_t>> compressedBlocks(header.blockCount);
+        std::vector<uint32_t>             blockIndices(header.blockCount);
+
+        std::iota(blockIndices.begin(), blockIndices.end(), 0U);
+
+        std::for_each(std::execution::par, 
+                      blockIndices.begin(), 
+                      blockIndices.end(), 
+                      [&](const uint32_t blockIndex)
+                      {
+                          const size_t firstByte = (size_t)blockIndex * header.blockSizeBytes;
+                          const size_t byteCount = std::min<size_t>(header.blockSizeBytes, packedStates.size() - firstByte);
+
+                          CellStateCodec::Compress(packedStates.data() + firstByte, 
+                                                   byteCount, 
+                                                   compressedBlocks[blockIndex]);
+                      });
+
+        std::vector<uint32_t> blockSizes(header.blockCount);
+
+        for (uint32_t i = 0; i < header.blockCount; ++i)
+        {
+            blockSizes[i] = (uint32_t)compressedBlocks[i].size();
+        }
+
+        // Write to a temporary file and swap it in once complete, 
+        // so the previous checkpoint survives a crash mid-save
+        const std::filesystem::path checkpointPath(filePath);
+        const std::filesystem::path temporaryPath = checkpointPath.string() + ".tmp";
+
+        std::error_code errorCode{};
+
+        if (checkpointPath.has_parent_path())
+        {
+            std::filesystem::create_directories(checkpointPath.parent_path(), errorCode);
+        }
+
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+
+            if (!file.is_open())
+            {
+                printf_s("Failed to open checkpoint for writing: %s\n", filePath.c_str());
+
+                return false;
+            }
+
+            file.write((const char*)&header, sizeof(CheckpointHeader));
+            file.write((const char*)blockSizes.data(), blockSizes.size() * sizeof(uint32_t));
+
+            for (const std::vector<uint8_t>& compressedBlock : compressedBlocks)
+            {
+                file.write((const char*)compressedBlock.data(), compressedBlock.size());
+            }
+
+            if (!file.good())
+            {
+                printf_s("Failed to write checkpoint: %s\n", filePath.c_str());
+
+                return false;
+            }
+        }
+
+        std::filesystem::rename(temporaryPath, checkpointPath, errorCode);
+
+        if (errorCode)
+        {
+            printf_s("Failed to replace checkpoint: %s\n", filePath.c_str());
+
+            return false;
+        }
+
+        printf_s("Saved checkpoint at generation %llu: %s\n", header.generation, filePath.c_str());
+
+        return true;
+    }
+
+    bool CheckpointSystem::IsHeaderValid(const CheckpointHeader& header)
+    {
+        if (header.magic != CheckpointHeader::MAGIC || 
+            header.version != CheckpointHeader::VERSION)
+        {
+            return false;
+        }
+
+        for (const uint32_t axisSize : header.dimensions)
+        {
+            if (axisSize < MIN_CELLS_PER_AXIS_COUNT || 
+                axisSize > MAX_CELLS_PER_AXIS_COUNT)
+            {
+                return false;
+            }
+        }
+
+        const size_t cellCount  = (size_t)header.dimensions[0] * header.dimensions[1] * header.dimensions[2];
+        const size_t packedSize = CellStateCodec::GetPackedSizeBytes(cellCount);
+
+        return header.cellCount == cellCount && 
+               header.neighbourhoodType < (uint8_t)NeighbourhoodType::COUNT &&
+               header.blockSizeBytes > 0U &&
+               header.blockCount == (packedSize + header.blockSizeBytes - 1U) / header.blockSizeBytes;
+    }
+
+    void CheckpointSystem::WaitForPendingSave()
+    {
+        if (!_pendingSave.valid())
+        {
+            return;
+        }
+
+        _pendingSave.get();
+    }
+}
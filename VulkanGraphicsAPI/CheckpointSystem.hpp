@@ -0,0 +1,56 @@
+#pragma once
+#include <filesystem>
+#include <fstream>
+#include <atomic>
+#include <future>
+
+#include "SolGrid.hpp"
+#include "SolMappedFile.hpp"
+#include "CellStateCodec.hpp"
+#include "CheckpointHeader.hpp"
+#include "GameOfLifeSettings.hpp"
+#include "SimulationSettings.hpp"
+
+using namespace SolEngine::Data;
+using namespace SolEngine::Settings;
+
+namespace SolEngine::System
+{
+    class CheckpointSystem
+    {
+    public:
+        static constexpr const char* CHECKPOINT_FILE_PATH{ "Checkpoints/Simulation.solcp" };
+
+        CheckpointSystem(SolGrid& rSolGrid, GridSettings& rGridSettings, GameOfLifeSettings& rGameOfLifeSettings, SimulationSettings& rSimulationSettings);
+        ~CheckpointSystem();
+
+        /// <summary>
+        /// Snapshots the current generation, then compresses and writes it to disk on a worker thread.
+        /// </summary>
+        void SaveAsync(const std::string& filePath);
+
+        /// <summary>
+        /// Restores the grid, rules, seed and generation from a checkpoint.
+        /// The grid is re-initialised when the dimensions differ.
+        /// </summary>
+        /// <returns>False if the file is missing or malformed, the current simulation is left untouched.</returns>
+        bool Load(const std::string& filePath);
+
+        bool IsSaving() const;
+
+    private:
+        static constexpr uint32_t BLOCK_SIZE_BYTES{ 1U << 16 };    // Packed bytes per independently compressed block (512K cells)
+
+        static bool WriteCheckpoint(const std::string& filePath, const CheckpointHeader& header, const std::vector<uint8_t>& packedStates);
+        static bool IsHeaderValid(const CheckpointHeader& header);
+
+        void WaitForPendingSave();
+
+        SolGrid&            _rSolGrid;
+        GridSettings&       _rGridSettings;
+        GameOfLifeSettings& _rGameOfLifeSettings;
+        SimulationSettings& _rSimulationSettings;
+
+        std::future<bool> _pendingSave;
+    };
+}
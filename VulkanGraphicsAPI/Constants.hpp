@@ -287,4 +287,38 @@ namespace SolEngine::Data
         { 0, 3, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
         { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}
     };
+
+    static constexpr size_t CUBE_EDGE_COUNT{ 12 };
+
+    // Midpoint of each TRI_TABLE edge, relative to the cube's first corner (y grows downwards)
+    static constexpr glm::vec3 EDGE_MIDPOINT_OFFSETS[CUBE_EDGE_COUNT]
+    {
+        { 0.5f,  0.f,   0.f  },   // 0:  Corners 0 - 1
+        { 1.f,   0.f,   0.5f },   // 1:  Corners 1 - 2
+        { 0.5f,  0.f,   1.f  },   // 2:  Corners 2 - 3
+        { 0.f,   0.f,   0.5f },   // 3:  Corners 3 - 0
+        { 0.5f, -1.f,   0.f  },   // 4:  Corners 4 - 5
+        { 1.f,  -1.f,   0.5f },   // 5:  Corners 5 - 6
+        { 0.5f, -1.f,   1.f  },   // 6:  Corners 6 - 7
+        { 0.f,  -1.f,   0.5f },   // 7:  Corners 7 - 4
+        { 0.f,  -0.5f,  0.f  },   // 8:  Corners 0 - 4
+        { 1.f,  -0.5f,  0.f  },   // 9:  Corners 1 - 5
+        { 1.f,  -0.5f,  1.f  },   // 10: Corners 2 - 6
+        { 0.f,  -0.5f,  1.f  }    // 11: Corners 3 - 7
+    };
+
+    // Cell index offset of each cube corner (y indices grow as world y falls)
+    static constexpr glm::ivec3 CUBE_CORNER_OFFSETS[CUBE_VERTEX_COUNT]
+    {
+        { 0, 0, 0 }, { 1, 0, 0 }, { 1, 0, 1 }, { 0, 0, 1 },
+        { 0, 1, 0 }, { 1, 1, 0 }, { 1, 1, 1 }, { 0, 1, 1 }
+    };
+
+    // The 2 corners that make up each TRI_TABLE edge
+    static constexpr Index_t EDGE_CORNER_INDICES[CUBE_EDGE_COUNT][2]
+    {
+        { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 },
+        { 4, 5 }, { 5, 6 }, { 6, 7 }, { 7, 4 },
+        { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 }
+    };
 }
\ No newline at end of file
@@ -4,9 +4,10 @@ namespace SolEngine::Data
 {
 	struct DiagnosticData
 	{
-		size_t GetTotalMemoryAllocatedBytes() const { return gridMemoryAllocatedBytes + verticesMemoryAllocatedBytes; }
-		size_t GetTotalMemoryUsedBytes()	  const { return gridMemoryUsedBytes + verticesMemoryUsedBytes; }
-		float  GetMemoryUsedPercentage()      const { return ((float)GetTotalMemoryUsedBytes() / GetTotalMemoryAllocatedBytes()) * 100.f; }
+		size_t GetTotalMemoryAllocatedBytes()  const { return gridMemoryAllocatedBytes + verticesMemoryAllocatedBytes; }
+		size_t GetTotalMemoryUsedBytes()	   const { return gridMemoryUsedBytes + verticesMemoryUsedBytes; }
+		float  GetMemoryUsedPercentage()       const { return ((float)GetTotalMemoryUsedBytes() / GetTotalMemoryAllocatedBytes()) * 100.f; }
+		float  GetDeviceMemoryUsedPercentage() const { return ((float)deviceMemoryUsedBytes / deviceMemoryAllocatedBytes) * 100.f; }
 
 		// Frame time data
 		float deltaTimeSeconds{ 0.f };
@@ -19,8 +20,23 @@ namespace SolEngine::Data
 		size_t verticesMemoryAllocatedBytes{ 0U };
 		size_t verticesMemoryUsedBytes	   { 0U };
 
+		// Device memory data, blocks include dedicated allocations
+		size_t deviceMemoryAllocatedBytes  { 0U };
+		size_t deviceMemoryUsedBytes	   { 0U };
+		size_t deviceMemoryBlockCount	   { 0U };
+		size_t deviceMemoryAllocationCount { 0U };
+
 		// Geometry data
 		size_t vertexCount{ 0U };
 		size_t triCount   { 0U };
+
+		// Culling data, from the last frame drawn
+		size_t chunkCount		  { 0U };
+		size_t culledChunkCount	  { 0U };
+		size_t drawnVertexCount	  { 0U };
+		size_t lowDetailChunkCount{ 0U };	// Drawn below full resolution
+
+		// Simulation data
+		float generationsPerSecond{ 0.f };
 	};
 }
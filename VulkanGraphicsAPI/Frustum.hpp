@@ -0,0 +1,62 @@
+#pragma once
+#include <array>
+#include <glm/glm.hpp>
+
+namespace SolEngine::Math
+{
+    /// <summary>
+    /// The six clip planes of a projection, for culling bounding boxes on the CPU.
+    /// </summary>
+    struct Frustum
+    {
+        /// <summary>
+        /// Extracts the planes from a Vulkan (0 to 1 depth) projection.
+        /// Boxes are tested in whichever space the matrix transforms from, e.g. model space for a Model-View-Projection.
+        /// </summary>
+        Frustum(const glm::mat4& matrix)
+        {
+            const glm::vec4 row0{ matrix[0][0], matrix[1][0], matrix[2][0], matrix[3][0] };
+            const glm::vec4 row1{ matrix[0][1], matrix[1][1], matrix[2][1], matrix[3][1] };
+            const glm::vec4 row2{ matrix[0][2], matrix[1][2], matrix[2][2], matrix[3][2] };
+            const glm::vec4 row3{ matrix[0][3], matrix[1][3], matrix[2][3], matrix[3][3] };
+
+            planes =
+            {
+                row3 + row0,    // Left
+                row3 - row0,    // Right
+                row3 + row1,    // Bottom
+                row3 - row1,    // Top
+                row2,           // Near
+                row3 - row2     // Far
+            };
+        }
+
+        /// <summary>
+        /// Conservative, so a box just outside a corner of the frustum can still pass.
+        /// </summary>
+        bool IsBoxVisible(const glm::vec3& minBounds, 
+                          const glm::vec3& maxBounds) const
+        {
+            for (const glm::vec4& plane : planes)
+            {
+                // The corner furthest along the plane's normal
+                const glm::vec3 positiveCorner
+                {
+                    (plane.x >= 0.f) ? maxBounds.x : minBounds.x,
+                    (plane.y >= 0.f) ? maxBounds.y : minBounds.y,
+                    (plane.z >= 0.f) ? maxBounds.z : minBounds.z
+                };
+
+                // Entirely behind this plane
+                if (glm::dot(glm::vec3(plane), positiveCorner) + plane.w < 0.f)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        std::array<glm::vec4, 6> planes;
+    };
+}
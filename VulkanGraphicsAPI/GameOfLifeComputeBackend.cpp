@@ -0,0 +1,599 @@
+#include <cstring>
+
+#include "GameOfLifeComputeBackend.hpp"
+
+namespace SolEngine::System
+{
+    GameOfLifeComputeBackend::GameOfLifeComputeBackend(SolDevice& rSolDevice,
+                                                       SolShaderLibrary& rSolShaderLibrary,
+                                                       SolGrid& rSolGrid,
+                                                       GameOfLifeSettings& rGameOfLifeSettings)
+        : _rSolDevice(rSolDevice),
+          _rSolShaderLibrary(rSolShaderLibrary),
+          _rSolGrid(rSolGrid),
+          _rGameOfLifeSettings(rGameOfLifeSettings)
+    {
+        // Shaders are compiled by hand with compile_shaders.bat, so carry on with just the CPU if it hasn't been
+        if (!std::filesystem::exists(COMPUTE_SHADER_PATH))
+        {
+            DebugHelpers::DPrintf("Compute Shader missing, GPU Compute simulation is unavailable: %s\n",
+                                  COMPUTE_SHADER_PATH);
+
+            return;
+        }
+
+        CreateBuffers();
+        CreateDescriptorSets();
+        CreatePipeline();
+        CreateSubmissionResources();
+    }
+
+    GameOfLifeComputeBackend::~GameOfLifeComputeBackend()
+    {
+        Dispose();
+    }
+
+    void GameOfLifeComputeBackend::SubmitGenerations(const uint32_t generationCount)
+    {
+        DBG_ASSERT_MSG(IsAvailable(),
+                       "Cannot step generations without the Compute Pipeline.");
+        DBG_ASSERT_MSG(!_isBatchInFlight,
+                       "Cannot submit generations whilst the last batch is still in flight.");
+
+        const glm::uvec3 gridDimensions = _rSolGrid.GetDimensions();
+        const size_t     cellCount      = (size_t)gridDimensions.x * gridDimensions.y * gridDimensions.z;
+
+        // The shader works in whole words, the padding cells are never read
+        const VkDeviceSize stateSizeBytes = ((cellCount + CELLS_PER_WORD - 1U) / CELLS_PER_WORD) * CELLS_PER_WORD;
+
+        // Otherwise the storage buffers already hold the last batch's generation
+        const bool isUploadRequired = _isHostCellStatesChanged;
+
+        if (isUploadRequired)
+        {
+            std::memcpy(_pTransferBuffer->GetMappedMemory(),
+                        _rSolGrid.cells.pCellStates,
+                        cellCount);
+
+            _pTransferBuffer->FlushBuffer(stateSizeBytes);
+
+            _isHostCellStatesChanged = false;
+        }
+
+        const VkCommandBufferBeginInfo beginInfo
+        {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+            .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+        };
+
+        // The pool resets the buffer when it's begun again
+        VkResult result = vkBeginCommandBuffer(_commandBuffer, 
+                                               &beginInfo);
+
+        DBG_ASSERT_VULKAN_MSG(result, 
+                              "Failed to begin Compute Command Buffer!");
+
+        RecordGenerations(_commandBuffer,
+                          generationCount,
+                          stateSizeBytes,
+                          isUploadRequired);
+
+        result = vkEndCommandBuffer(_commandBuffer);
+
+        DBG_ASSERT_VULKAN_MSG(result, 
+                              "Failed to end Compute Command Buffer!");
+
+        const VkSubmitInfo submitInfo
+        {
+            .sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+            .commandBufferCount = 1,
+            .pCommandBuffers    = &_commandBuffer
+        };
+
+        result = vkResetFences(_rSolDevice.GetDevice(), 
+                               1, 
+                               &_batchFence);
+
+        DBG_ASSERT_VULKAN_MSG(result, 
+                              "Failed to reset Compute Batch Fence!");
+
+        // Signals the fence rather than idling the queue, so the frames in flight carry on
+        result = vkQueueSubmit(_rSolDevice.GetGraphicsQueue(), 
+                               1, 
+                               &submitInfo, 
+                               _batchFence);
+
+        DBG_ASSERT_VULKAN_MSG(result, 
+                              "Failed to Submit Compute Batch!");
+
+        _stateBufferIndex     = (_stateBufferIndex + generationCount) % STATE_BUFFER_COUNT;
+        _batchGenerationCount = generationCount;
+        _batchCellCount       = cellCount;
+        _isBatchInFlight      = true;
+    }
+
+    bool GameOfLifeComputeBackend::ReadBackGenerations(const bool isWaitRequired,
+                                                       uint32_t& rOutGenerationCount,
+                                                       float& rOutComputeTime)
+    {
+        if (!_isBatchInFlight)
+        {
+            return false;
+        }
+
+        const VkResult fenceStatus = isWaitRequired ? vkWaitForFences(_rSolDevice.GetDevice(), 1, &_batchFence, VK_TRUE, UINT64_MAX)
+                                                    : vkGetFenceStatus(_rSolDevice.GetDevice(), _batchFence);
+
+        if (fenceStatus == VK_NOT_READY)
+        {
+            return false;
+        }
+
+        DBG_ASSERT_VULKAN_MSG(fenceStatus, 
+                              "Failed to wait for Compute Batch Fence!");
+
+        _isBatchInFlight = false;
+
+        // The CPU's cells were edited whilst the batch ran, they win and get uploaded with the next batch
+        if (_isHostCellStatesChanged)
+        {
+            return false;
+        }
+
+        const VkDeviceSize stateSizeBytes = ((_batchCellCount + CELLS_PER_WORD - 1U) / CELLS_PER_WORD) * CELLS_PER_WORD;
+
+        _pTransferBuffer->InvalidateBuffer(stateSizeBytes);
+
+        std::memcpy(_rSolGrid.cells.pCellStates,
+                    _pTransferBuffer->GetMappedMemory(),
+                    _batchCellCount);
+
+        rOutGenerationCount = _batchGenerationCount;
+        rOutComputeTime     = -1.f;
+
+        if (_timestampPool == VK_NULL_HANDLE)
+        {
+            return true;
+        }
+
+        uint64_t timestamps[TIMESTAMP_COUNT]{};
+
+        const VkResult result = vkGetQueryPoolResults(_rSolDevice.GetDevice(),
+                                                      _timestampPool,
+                                                      0,
+                                                      TIMESTAMP_COUNT,
+                                                      sizeof(timestamps),
+                                                      timestamps,
+                                                      sizeof(uint64_t),
+                                                      VK_QUERY_RESULT_64_BIT);
+
+        if (result == VK_SUCCESS)
+        {
+            rOutComputeTime = (float)((double)(timestamps[1] - timestamps[0]) * _timestampPeriod * 1e-9);
+        }
+
+        return true;
+    }
+
+    void GameOfLifeComputeBackend::RebuildPipeline()
+    {
+        // Never built, as the shader was missing at start up
+        if (_pDescriptorSetLayout == nullptr)
+        {
+            return;
+        }
+
+        DestroyPipeline();
+        CreatePipeline();
+    }
+
+    void GameOfLifeComputeBackend::Dispose()
+    {
+        // The batch in flight is still using everything below
+        if (_isBatchInFlight)
+        {
+            vkWaitForFences(_rSolDevice.GetDevice(), 
+                            1, 
+                            &_batchFence, 
+                            VK_TRUE, 
+                            UINT64_MAX);
+
+            _isBatchInFlight = false;
+        }
+
+        vkDestroyQueryPool(_rSolDevice.GetDevice(),
+                           _timestampPool,
+                           NULL);
+
+        vkDestroyFence(_rSolDevice.GetDevice(),
+                       _batchFence,
+                       NULL);
+
+        // The pool frees its command buffer
+        vkDestroyCommandPool(_rSolDevice.GetDevice(),
+                             _commandPool,
+                             NULL);
+
+        _timestampPool = VK_NULL_HANDLE;
+        _batchFence    = VK_NULL_HANDLE;
+        _commandPool   = VK_NULL_HANDLE;
+        _commandBuffer = VK_NULL_HANDLE;
+
+        DestroyPipeline();
+
+        // The pool frees its sets
+        _pDescriptorPool      = nullptr;
+        _pDescriptorSetLayout = nullptr;
+
+        _pTransferBuffer = nullptr;
+
+        for (std::unique_ptr<SolBuffer>& pStateBuffer : _pStateBuffers)
+        {
+            pStateBuffer = nullptr;
+        }
+    }
+
+    void GameOfLifeComputeBackend::CreateBuffers()
+    {
+        // Big enough for the largest grid, so resizing it never recreates anything
+        for (std::unique_ptr<SolBuffer>& pStateBuffer : _pStateBuffers)
+        {
+            pStateBuffer = std::make_unique<SolBuffer>(_rSolDevice,
+                                                       sizeof(bool),
+                                                       MAX_CELLS_COUNT,
+                                                       VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                                       VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        }
+
+        // Read back every batch, so cached memory is worth having when there is some
+        const std::vector<VkMemoryPropertyFlags> preferredMemoryProperties
+        {
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+        };
+
+        _pTransferBuffer = std::make_unique<SolBuffer>(_rSolDevice,
+                                                       sizeof(bool),
+                                                       MAX_CELLS_COUNT,
+                                                       VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                                       preferredMemoryProperties);
+
+        const VkResult result = _pTransferBuffer->Map();
+
+        DBG_ASSERT_VULKAN_MSG(result,
+                              "Failed to Map Transfer Buffer.");
+    }
+
+    void GameOfLifeComputeBackend::CreateDescriptorSets()
+    {
+        _pDescriptorSetLayout = SolDescriptorSetLayout::Builder(_rSolDevice).AddBinding(0,
+                                                                                        VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                                        VK_SHADER_STAGE_COMPUTE_BIT)
+                                                                            .AddBinding(1,
+                                                                                        VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                                        VK_SHADER_STAGE_COMPUTE_BIT)
+                                                                            .Build();
+
+        _pDescriptorPool = SolDescriptorPool::Builder(_rSolDevice).SetMaxDescriptorSets(STATE_BUFFER_COUNT)
+                                                                  .AddPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                               STATE_BUFFER_COUNT * 2U)
+                                                                  .Build();
+
+        // Each set reads one buffer and writes the other, so generations alternate between them
+        for (uint32_t i(0U); i < STATE_BUFFER_COUNT; ++i)
+        {
+            const VkDescriptorBufferInfo cellStatesInfo     = _pStateBuffers[i]->DescriptorBufferInfo();
+            const VkDescriptorBufferInfo nextCellStatesInfo = _pStateBuffers[(i + 1U) % STATE_BUFFER_COUNT]->DescriptorBufferInfo();
+
+            const bool isDescriptorSetBuilt = SolDescriptorWriter(*_pDescriptorSetLayout, *_pDescriptorPool).WriteBuffer(0, &cellStatesInfo)
+                                                                                                            .WriteBuffer(1, &nextCellStatesInfo)
+                                                                                                            .Build(_descriptorSets[i]);
+
+            DBG_ASSERT_MSG(isDescriptorSetBuilt,
+                           "Failed to Build Compute Descriptor Set.");
+        }
+    }
+
+    void GameOfLifeComputeBackend::CreateSubmissionResources()
+    {
+        const uint32_t queueFamilyIndex = _rSolDevice.QueryPhysicalDeviceQueueFamilies().graphicsFamily;
+
+        const VkCommandPoolCreateInfo commandPoolCreateInfo
+        {
+            .sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+            .flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,    // The one buffer is re-recorded every batch
+            .queueFamilyIndex = queueFamilyIndex
+        };
+
+        VkResult result = vkCreateCommandPool(_rSolDevice.GetDevice(),
+                                              &commandPoolCreateInfo,
+                                              NULL,
+                                              &_commandPool);
+
+        DBG_ASSERT_VULKAN_MSG(result, 
+                              "Failed to create Compute Command Pool.");
+
+        const VkCommandBufferAllocateInfo allocateInfo
+        {
+            .sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+            .commandPool        = _commandPool,
+            .level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+            .commandBufferCount = 1
+        };
+
+        result = vkAllocateCommandBuffers(_rSolDevice.GetDevice(), 
+                                          &allocateInfo, 
+                                          &_commandBuffer);
+
+        DBG_ASSERT_VULKAN_MSG(result, 
+                              "Failed to allocate Compute Command Buffer.");
+
+        const VkFenceCreateInfo fenceCreateInfo
+        {
+            .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO
+        };
+
+        result = vkCreateFence(_rSolDevice.GetDevice(), 
+                               &fenceCreateInfo,    
+                               NULL, 
+                               &_batchFence);
+
+        DBG_ASSERT_VULKAN_MSG(result, 
+                              "Failed to create Compute Batch Fence.");
+
+        uint32_t queueFamilyCount(0U);
+        vkGetPhysicalDeviceQueueFamilyProperties(_rSolDevice.GetPhysicalDevice(), &queueFamilyCount, NULL);
+
+        std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(_rSolDevice.GetPhysicalDevice(), &queueFamilyCount, queueFamilies.data());
+
+        // Without timestamps the batch can't be timed, so fast forward keeps its batch size
+        if (queueFamilies.at(queueFamilyIndex).timestampValidBits == 0U)
+        {
+            DebugHelpers::DPrintf("Graphics Queue has no timestamp support, GPU Compute batches won't be timed.\n");
+
+            return;
+        }
+
+        const VkQueryPoolCreateInfo queryPoolCreateInfo
+        {
+            .sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+            .queryType  = VK_QUERY_TYPE_TIMESTAMP,
+            .queryCount = TIMESTAMP_COUNT
+        };
+
+        result = vkCreateQueryPool(_rSolDevice.GetDevice(), 
+                                   &queryPoolCreateInfo, 
+                                   NULL, 
+                                   &_timestampPool);
+
+        DBG_ASSERT_VULKAN_MSG(result, 
+                              "Failed to create Compute Timestamp Query Pool.");
+
+        _timestampPeriod = _rSolDevice.GetProperties().limits.timestampPeriod;
+    }
+
+    void GameOfLifeComputeBackend::DestroyPipeline()
+    {
+        vkDestroyPipeline(_rSolDevice.GetDevice(),
+                          _pipeline,
+                          NULL);
+
+        vkDestroyPipelineLayout(_rSolDevice.GetDevice(),
+                                _pipelineLayout,
+                                NULL);
+
+        _pipeline       = VK_NULL_HANDLE;
+        _pipelineLayout = VK_NULL_HANDLE;
+    }
+
+    void GameOfLifeComputeBackend::CreatePipeline()
+    {
+        const VkShaderModule computeShaderModule = _rSolShaderLibrary.GetShaderModule(COMPUTE_SHADER_PATH);
+
+        if (computeShaderModule == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        const VkPushConstantRange pushConstantRange
+        {
+            .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+            .offset     = 0,
+            .size       = sizeof(PushConstantData)
+        };
+
+        const VkDescriptorSetLayout descriptorSetLayout = _pDescriptorSetLayout->GetDescriptorSetLayout();
+
+        const VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo
+        {
+            .sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+            .setLayoutCount         = 1,
+            .pSetLayouts            = &descriptorSetLayout,
+            .pushConstantRangeCount = 1,
+            .pPushConstantRanges    = &pushConstantRange
+        };
+
+        VkResult result = vkCreatePipelineLayout(_rSolDevice.GetDevice(),
+                                                 &pipelineLayoutCreateInfo,
+                                                 NULL,
+                                                 &_pipelineLayout);
+
+        DBG_ASSERT_VULKAN_MSG(result,
+                              "Failed to Create Compute Pipeline Layout.");
+
+        const VkComputePipelineCreateInfo pipelineCreateInfo
+        {
+            .sType  = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+            .stage  = VkPipelineShaderStageCreateInfo
+            {
+                .sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+                .stage  = VK_SHADER_STAGE_COMPUTE_BIT,
+                .module = computeShaderModule,
+                .pName  = "main"
+            },
+            .layout = _pipelineLayout
+        };
+
+        result = vkCreateComputePipelines(_rSolDevice.GetDevice(),
+                                          _rSolDevice.GetPipelineCache(),
+                                          1,
+                                          &pipelineCreateInfo,
+                                          NULL,
+                                          &_pipeline);
+
+        DBG_ASSERT_VULKAN_MSG(result,
+                              "Failed to Create Compute Pipeline.");
+
+        if (result != VK_SUCCESS)
+        {
+            _pipeline = VK_NULL_HANDLE;
+        }
+    }
+
+    void GameOfLifeComputeBackend::RecordGenerations(const VkCommandBuffer commandBuffer,
+                                                     const uint32_t generationCount,
+                                                     const VkDeviceSize stateSizeBytes,
+                                                     const bool isUploadRequired)
+    {
+        const auto InsertMemoryBarrier = [commandBuffer](const VkAccessFlags srcAccessMask,
+                                                         const VkAccessFlags dstAccessMask,
+                                                         const VkPipelineStageFlags srcStageMask,
+                                                         const VkPipelineStageFlags dstStageMask)
+        {
+            const VkMemoryBarrier memoryBarrier
+            {
+                .sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+                .srcAccessMask = srcAccessMask,
+                .dstAccessMask = dstAccessMask
+            };
+
+            vkCmdPipelineBarrier(commandBuffer,
+                                 srcStageMask,
+                                 dstStageMask,
+                                 0,
+                                 1,
+                                 &memoryBarrier,
+                                 0,
+                                 NULL,
+                                 0,
+                                 NULL);
+        };
+
+        const VkBufferCopy copyRegion
+        {
+            .srcOffset = 0,
+            .dstOffset = 0,
+            .size      = stateSizeBytes
+        };
+
+        // Carries on from the buffer holding the current generation
+        const uint32_t firstStateBufferIndex = _stateBufferIndex;
+        const uint32_t lastStateBufferIndex  = (firstStateBufferIndex + generationCount) % STATE_BUFFER_COUNT;
+
+        // The last batch's generations and readback have to land before this one reads or overwrites them
+        InsertMemoryBarrier(VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
+                            VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
+                            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+        if (isUploadRequired)
+        {
+            vkCmdCopyBuffer(commandBuffer,
+                            _pTransferBuffer->GetBuffer(),
+                            _pStateBuffers[firstStateBufferIndex]->GetBuffer(),
+                            1,
+                            &copyRegion);
+
+            InsertMemoryBarrier(VK_ACCESS_TRANSFER_WRITE_BIT,
+                                VK_ACCESS_SHADER_READ_BIT,
+                                VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+        }
+
+        // Only the generations are timed, not the upload or readback
+        if (_timestampPool != VK_NULL_HANDLE)
+        {
+            vkCmdResetQueryPool(commandBuffer,
+                                _timestampPool,
+                                0,
+                                TIMESTAMP_COUNT);
+
+            // Once the upload has landed
+            vkCmdWriteTimestamp(commandBuffer,
+                                VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                _timestampPool,
+                                0);
+        }
+
+        const glm::uvec3 gridDimensions = _rSolGrid.GetDimensions();
+
+        const PushConstantData pushConstantData
+        {
+            .dimensions           = gridDimensions,
+            .cellCount            = gridDimensions.x * gridDimensions.y * gridDimensions.z,
+            .underpopulationCount = _rGameOfLifeSettings.underpopulationCount,
+            .overpopulationCount  = _rGameOfLifeSettings.overpopulationCount,
+            .reproductionCount    = _rGameOfLifeSettings.reproductionCount,
+            .isMoore              = _rGameOfLifeSettings.neighbourhoodType == NeighbourhoodType::MOORE
+        };
+
+        const uint32_t wordCount      = (uint32_t)(stateSizeBytes / CELLS_PER_WORD);
+        const uint32_t workgroupCount = (wordCount + WORKGROUP_SIZE - 1U) / WORKGROUP_SIZE;
+
+        vkCmdBindPipeline(commandBuffer,
+                          VK_PIPELINE_BIND_POINT_COMPUTE,
+                          _pipeline);
+
+        vkCmdPushConstants(commandBuffer,
+                           _pipelineLayout,
+                           VK_SHADER_STAGE_COMPUTE_BIT,
+                           0,
+                           sizeof(PushConstantData),
+                           &pushConstantData);
+
+        for (uint32_t generation(0U); generation < generationCount; ++generation)
+        {
+            vkCmdBindDescriptorSets(commandBuffer,
+                                    VK_PIPELINE_BIND_POINT_COMPUTE,
+                                    _pipelineLayout,
+                                    0,
+                                    1,
+                                    &_descriptorSets[(firstStateBufferIndex + generation) % STATE_BUFFER_COUNT],
+                                    0,
+                                    NULL);
+
+            vkCmdDispatch(commandBuffer,
+                          workgroupCount,
+                          1,
+                          1);
+
+            // Each generation reads what the last one wrote
+            InsertMemoryBarrier(VK_ACCESS_SHADER_WRITE_BIT,
+                                VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT,
+                                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT);
+        }
+
+        if (_timestampPool != VK_NULL_HANDLE)
+        {
+            vkCmdWriteTimestamp(commandBuffer,
+                                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                _timestampPool,
+                                1);
+        }
+
+        // Only the final generation comes back to the CPU
+        vkCmdCopyBuffer(commandBuffer,
+                        _pStateBuffers[lastStateBufferIndex]->GetBuffer(),
+                        _pTransferBuffer->GetBuffer(),
+                        1,
+                        &copyRegion);
+
+        InsertMemoryBarrier(VK_ACCESS_TRANSFER_WRITE_BIT,
+                            VK_ACCESS_HOST_READ_BIT,
+                            VK_PIPELINE_STAGE_TRANSFER_BIT,
+                            VK_PIPELINE_STAGE_HOST_BIT);
+    }
+}
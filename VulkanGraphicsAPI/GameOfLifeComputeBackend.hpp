@@ -0,0 +1,113 @@
+#pragma once
+#include "SolBuffer.hpp"
+#include "SolShaderLibrary.hpp"
+#include "SolDescriptorWriter.hpp"
+#include "SolGrid.hpp"
+#include "GameOfLifeSettings.hpp"
+
+using namespace SolEngine::Descriptors;
+using namespace SolEngine::Settings;
+
+namespace SolEngine::System
+{
+    /// <summary>
+    /// Steps the Game of Life with a compute shader, ping-ponging the cell states between two storage buffers.
+    /// The storage buffers hold the current generation between batches, the CPU's cells are only uploaded after they've been edited.
+    /// Each batch is read back once at the end, never per generation, and never waited on unless asked to.
+    /// </summary>
+    class GameOfLifeComputeBackend : private IDisposable
+    {
+    public:
+        GameOfLifeComputeBackend(SolDevice& rSolDevice, SolShaderLibrary& rSolShaderLibrary, SolGrid& rSolGrid, GameOfLifeSettings& rGameOfLifeSettings);
+        ~GameOfLifeComputeBackend();
+
+        GameOfLifeComputeBackend(const GameOfLifeComputeBackend&)            = delete;
+        GameOfLifeComputeBackend& operator=(const GameOfLifeComputeBackend&) = delete;
+
+        /// <summary>
+        /// False if Shaders/GameOfLife.comp.spv hasn't been compiled, in which case the CPU has to step the cells.
+        /// </summary>
+        bool IsAvailable() const { return _pipeline != VK_NULL_HANDLE; }
+
+        bool IsBatchInFlight() const { return _isBatchInFlight; }
+
+        /// <summary>
+        /// The CPU's cells were changed outside of the batches (Reset, Checkpoints, Playback, CPU generations), 
+        /// so the next batch starts from them. Any batch in flight is discarded rather than read back over them.
+        /// </summary>
+        void MarkHostCellStatesChanged() { _isHostCellStatesChanged = true; }
+
+        /// <summary>
+        /// Submits generationCount generations, carrying on from the last batch. Doesn't wait for them, see ReadBackGenerations.
+        /// </summary>
+        void SubmitGenerations(const uint32_t generationCount);
+
+        /// <summary>
+        /// Copies the last generation of the batch in flight into the grid's cells once it has finished.
+        /// rOutComputeTime is the GPU time spent on the generations alone, or negative without timestamp support.
+        /// </summary>
+        /// <returns>False if the batch is still running (and isWaitRequired is false), or was discarded.</returns>
+        bool ReadBackGenerations(const bool isWaitRequired, uint32_t& rOutGenerationCount, float& rOutComputeTime);
+
+        /// <summary>
+        /// Rebuilds the pipeline from the shader library's current module, e.g. after the shader was hot reloaded.
+        /// </summary>
+        void RebuildPipeline();
+
+    private:
+        static constexpr const char* COMPUTE_SHADER_PATH{ "Shaders/GameOfLife.comp.spv" };
+        static constexpr uint32_t    WORKGROUP_SIZE     { 64U };    // Matches local_size_x
+        static constexpr uint32_t    CELLS_PER_WORD     { 4U };     // Cells are a byte each, the shader reads and writes them 4 at a time
+        static constexpr uint32_t    STATE_BUFFER_COUNT { 2U };     // Ping-pong
+        static constexpr uint32_t    TIMESTAMP_COUNT    { 2U };     // Before the first generation, after the last
+
+        struct PushConstantData
+        {
+            glm::uvec3 dimensions;
+            uint32_t   cellCount;
+            uint32_t   underpopulationCount;
+            uint32_t   overpopulationCount;
+            uint32_t   reproductionCount;
+            uint32_t   isMoore;
+        };
+
+        // Inherited via IDisposable
+        virtual void Dispose() override;
+
+        void CreateBuffers();
+        void CreateDescriptorSets();
+        void CreateSubmissionResources();
+        void CreatePipeline();
+        void DestroyPipeline();
+
+        void RecordGenerations(const VkCommandBuffer commandBuffer, const uint32_t generationCount, const VkDeviceSize stateSizeBytes, const bool isUploadRequired);
+
+        SolDevice&          _rSolDevice;
+        SolShaderLibrary&   _rSolShaderLibrary;
+        SolGrid&            _rSolGrid;
+        GameOfLifeSettings& _rGameOfLifeSettings;
+
+        std::unique_ptr<SolBuffer> _pStateBuffers[STATE_BUFFER_COUNT]{};
+        std::unique_ptr<SolBuffer> _pTransferBuffer                  {};    // Host visible, cells go up and come back down through it
+
+        std::unique_ptr<SolDescriptorSetLayout> _pDescriptorSetLayout{};
+        std::unique_ptr<SolDescriptorPool>      _pDescriptorPool     {};
+        VkDescriptorSet                         _descriptorSets[STATE_BUFFER_COUNT]{};    // [i] reads buffer i and writes the other
+
+        VkPipelineLayout _pipelineLayout{ VK_NULL_HANDLE };
+        VkPipeline       _pipeline      { VK_NULL_HANDLE };
+
+        // Batches are submitted alongside the frames rather than waited on straight away
+        VkCommandPool   _commandPool    { VK_NULL_HANDLE };
+        VkCommandBuffer _commandBuffer  { VK_NULL_HANDLE };
+        VkFence         _batchFence     { VK_NULL_HANDLE };
+        VkQueryPool     _timestampPool  { VK_NULL_HANDLE };     // Null without timestamp support on the graphics queue
+        float           _timestampPeriod{ 0.f };                // Nanoseconds per tick
+
+        uint32_t _stateBufferIndex       { 0U };       // Holds the current generation
+        bool     _isHostCellStatesChanged{ true };     // Nothing has been uploaded yet
+        bool     _isBatchInFlight        { false };
+        uint32_t _batchGenerationCount   { 0U };
+        size_t   _batchCellCount         { 0U };
+    };
+}
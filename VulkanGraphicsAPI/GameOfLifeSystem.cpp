@@ -1,139 +1,49 @@
+#include <cstring>
+
 #include "GameOfLifeSystem.hpp"
 
 namespace SolEngine::System
 {
     GameOfLifeSystem::GameOfLifeSystem(SolGrid& rSolGrid, 
+                                       GameOfLifeComputeBackend& rComputeBackend,
                                        GameOfLifeSettings& rGameOfLifeSettings,
-                                       SimulationSettings& rSimulationSettings)
+                                       SimulationSettings& rSimulationSettings,
+                                       DiagnosticData& rDiagnosticData)
         : _rSolGrid(rSolGrid),
+          _rComputeBackend(rComputeBackend),
           _rGameOfLifeSettings(rGameOfLifeSettings),
           _rSimulationSettings(rSimulationSettings),
+          _rDiagnosticData(rDiagnosticData),
           _nextGenerationDelayRemaining(rSimulationSettings.speed)
     {}
 
-    void GameOfLifeSystem::CheckAllCellNeighbours()
-    {
-        const uint32_t   neighbourOffset          = 1U;
-        const Cells&     gridCells                = _rSolGrid.cells;
-        const bool*      pCellStates              = gridCells.pCellStates;
-        const glm::uvec3 gridDimensions           = _rSolGrid.GetDimensions();
-        const glm::uvec3 validNeighbourDimensions = gridDimensions - glm::uvec3(1U);
-        const bool       areDiagonalsChecked      = _rGameOfLifeSettings.neighbourhoodType == NeighbourhoodType::MOORE;
-
-        uint32_t neighbourIndex(0);
-                                          
-        _rSolGrid.TraverseAllGridCells([&](const int xIndex, 
-                                           const int yIndex, 
-                                           const int zIndex)
-                                       {
-                                           const int cellIndex = _3DTo1DIndex(xIndex, 
-                                                                              yIndex, 
-                                                                              zIndex, 
-                                                                              gridDimensions);
-
-                                           if (cellIndex == -1)
-                                           {
-                                               // Cell Index is invalid, don't bother checking anything...
-
-                                               return;
-                                           }
-
-                                           NeighbourCount_t& rLiveNeighbourCount = 
-                                               gridCells.pLiveNeighbourCounts[cellIndex];
-
-                                           rLiveNeighbourCount = 0U;  // Reset the neighbour count
-
-                                           CheckAdjacentNeighbourStates(xIndex,
-                                                                        yIndex, 
-                                                                        zIndex, 
-                                                                        gridDimensions, 
-                                                                        pCellStates, 
-                                                                        rLiveNeighbourCount);
-
-                                           if (!areDiagonalsChecked)
-                                           {
-                                               return;
-                                           }
-
-                                           CheckDiagonalNeighbourStates(xIndex, 
-                                                                        yIndex, 
-                                                                        zIndex, 
-                                                                        gridDimensions, 
-                                                                        pCellStates, 
-                                                                        rLiveNeighbourCount);
-                                       });
-    }
-
-    void GameOfLifeSystem::UpdateAllCellStates()
+    void GameOfLifeSystem::Update(const float deltaTime)
     {
-        const NeighbourCount_t underpopulationCount = _rGameOfLifeSettings.underpopulationCount;
-        const NeighbourCount_t overpopulationCount  = _rGameOfLifeSettings.overpopulationCount;
-        const NeighbourCount_t reproductionCount    = _rGameOfLifeSettings.reproductionCount;
-
-        const glm::uvec3 dimensions = _rSolGrid.GetDimensions();
-
-        _rSolGrid.TraverseAllGridCells([&](const int xIndex,
-                                           const int yIndex,
-                                           const int zIndex)
-                                       {
-                                           Cells& rGridNodes = _rSolGrid.cells;
-                                       
-                                           const int cellIndex = _3DTo1DIndex(xIndex, 
-                                                                              yIndex, 
-                                                                              zIndex, 
-                                                                              dimensions);
-
-                                           if (cellIndex == -1)
-                                           {
-                                               return;
-                                           }
-                                       
-                                           bool&                  rIsCellAlive       = rGridNodes.pCellStates[cellIndex];
-                                           const NeighbourCount_t cellNeighbourCount = rGridNodes.pLiveNeighbourCounts[cellIndex];
-                                       
-                                           // Nothing to do - guarenteed dead
-                                           if (cellNeighbourCount == 0)
-                                           {
-                                               rIsCellAlive = false;
-
-                                               return;
-                                           }
-
-                                           if (rIsCellAlive)
-                                           {
-                                               rIsCellAlive = !(cellNeighbourCount < underpopulationCount ||    // Any live cell with fewer than underpopulationCount live neighbours dies, as if by underpopulation.
-                                                                cellNeighbourCount > overpopulationCount);      // Any live cell with more than overpopulationCount live neighbours dies, as if by overpopulation.
-
-                                               return;
-                                           }
-
-                                           // Any dead cell with exactly reproductionLiveNeighbourCount live neighbours becomes a live cell, as if by reproduction.
-                                           if (cellNeighbourCount != reproductionCount)
-                                           {
-                                               return;
-                                           }
-
-                                           rIsCellAlive = true;
-                                       });
+        UpdateGenerationsPerSecond(deltaTime);
 
-        onUpdateAllCellStatesEvent.Invoke();
-    }
+        // Picked up whenever it finishes, even once paused
+        if (_rComputeBackend.IsBatchInFlight())
+        {
+            ReadBackDeviceGenerations(false);
+        }
 
-    void GameOfLifeSystem::Update(const float deltaTime)
-    {
         if (_rSimulationSettings.state != SimulationState::PLAY)
         {
             return;
         }
 
-        if (_nextGenerationDelayRemaining > 0.f)
+        // Fast forwarding ignores the speed and steps for the whole time budget
+        if (!_rSimulationSettings.isFastForwardEnabled)
         {
             _nextGenerationDelayRemaining -= deltaTime;
 
-            return;
+            if (_nextGenerationDelayRemaining > 0.f)
+            {
+                return;
+            }
         }
 
-        NextGeneration();
+        StepGenerations();
     }
 
     void GameOfLifeSystem::ResetNextGenerationDelayRemaining()
@@ -141,279 +51,417 @@ namespace SolEngine::System
         _nextGenerationDelayRemaining = _rSimulationSettings.speed;
     }
 
-    inline void GameOfLifeSystem::CheckAdjacentNeighbourStates(const int xIndex,
-                                                               const int yIndex, 
-                                                               const int zIndex, 
-                                                               const glm::uvec3& gridDimensions, 
-                                                               const bool* pCellStates, 
-                                                               NeighbourCount_t& rLiveNeighbourCount)
+    void GameOfLifeSystem::StepAllCellStates()
     {
-        const uint32_t neighbourOffset = 1U;
-        const int      leftCellIndex   = xIndex - neighbourOffset;
-        const int      rightCellIndex  = xIndex + neighbourOffset;
-        const int      aboveCellIndex  = yIndex - neighbourOffset;
-        const int      belowCellIndex  = yIndex + neighbourOffset;
-        const int      backCellIndex   = zIndex - neighbourOffset;
-        const int      frontCellIndex  = zIndex + neighbourOffset;
-
-        // Left Cell Neighbour - 1
-        CheckNeighbourState(leftCellIndex, 
-                            yIndex,
-                            zIndex,
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Right Cell Neighbour - 2
-        CheckNeighbourState(rightCellIndex, 
-                            yIndex,
-                            zIndex,
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Above Cell Neighbour - 3
-        CheckNeighbourState(xIndex, 
-                            aboveCellIndex,
-                            zIndex,
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Below Cell Neighbour - 4
-        CheckNeighbourState(xIndex, 
-                            belowCellIndex,
-                            zIndex,
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Back Cell Neighbour - 5
-        CheckNeighbourState(xIndex, 
-                            yIndex,
-                            backCellIndex,
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Front Cell Neighbour - 6
-        CheckNeighbourState(xIndex, 
-                            yIndex,
-                            frontCellIndex,
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
+        const Cells&     gridCells           = _rSolGrid.cells;
+        const bool*      pCellStates         = gridCells.pCellStates;
+        bool*            pNextCellStates     = gridCells.pNextCellStates;
+        const glm::ivec3 gridDimensions      = glm::ivec3(_rSolGrid.GetDimensions());
+        const size_t     rowSize             = gridDimensions.x;
+        const size_t     sliceSize           = rowSize * gridDimensions.y;
+        const bool       areDiagonalsChecked = _rGameOfLifeSettings.neighbourhoodType == NeighbourhoodType::MOORE;
+
+        const bool* pNeighbourRows[NEIGHBOUR_ROWS_COUNT_MAX];
+
+        for (int zIndex(0); zIndex < gridDimensions.z; ++zIndex)
+        {
+            for (int yIndex(0); yIndex < gridDimensions.y; ++yIndex)
+            {
+                const size_t rowIndex = (zIndex * sliceSize) + (yIndex * rowSize);
+                uint32_t     neighbourRowCount(0U);
+
+                // Gather the rows surrounding this one which are inside the grid, 
+                // so the row kernels never have to bounds check along y or z
+                for (int zOffset(-1); zOffset <= 1; ++zOffset)
+                {
+                    for (int yOffset(-1); yOffset <= 1; ++yOffset)
+                    {
+                        const int  neighbourZIndex = zIndex + zOffset;
+                        const int  neighbourYIndex = yIndex + yOffset;
+                        const bool isOwnRow        = (yOffset == 0 && zOffset == 0);
+                        const bool isDiagonalRow   = (yOffset != 0 && zOffset != 0);
+
+                        if (neighbourZIndex < 0 || neighbourZIndex >= gridDimensions.z ||
+                            neighbourYIndex < 0 || neighbourYIndex >= gridDimensions.y)
+                        {
+                            continue;
+                        }
+
+                        // Von Neumann only cares about the orthogonal rows, the 
+                        // left and right neighbours are read from the own row
+                        if (!areDiagonalsChecked && (isOwnRow || isDiagonalRow))
+                        {
+                            continue;
+                        }
+
+                        pNeighbourRows[neighbourRowCount++] = 
+                            pCellStates + (neighbourZIndex * sliceSize) + (neighbourYIndex * rowSize);
+                    }
+                }
+
+                if (areDiagonalsChecked)
+                {
+                    StepRowMoore(pNeighbourRows, 
+                                 neighbourRowCount, 
+                                 pCellStates + rowIndex, 
+                                 pNextCellStates + rowIndex, 
+                                 gridDimensions.x);
+                }
+                else
+                {
+                    StepRowVonNeumann(pNeighbourRows, 
+                                      neighbourRowCount, 
+                                      pCellStates + rowIndex, 
+                                      pNextCellStates + rowIndex, 
+                                      gridDimensions.x);
+                }
+            }
+        }
     }
 
-    inline void GameOfLifeSystem::CheckDiagonalNeighbourStates(const int xIndex, 
-                                                               const int yIndex, 
-                                                               const int zIndex, 
-                                                               const glm::uvec3& gridDimensions,
-                                                               const bool* pCellStates, 
-                                                               NeighbourCount_t& rLiveNeighbourCount)
+    inline void GameOfLifeSystem::StepRowMoore(const bool* const* ppNeighbourRows,
+                                               const uint32_t neighbourRowCount, 
+                                               const bool* pRow, 
+                                               bool* pNextRow, 
+                                               const int rowWidth) const
     {
-        const uint32_t neighbourOffset = 1U;
-        const int      leftCellIndex   = xIndex - neighbourOffset;
-        const int      rightCellIndex  = xIndex + neighbourOffset;
-        const int      aboveCellIndex  = yIndex - neighbourOffset;
-        const int      belowCellIndex  = yIndex + neighbourOffset;
-        const int      backCellIndex   = zIndex - neighbourOffset;
-        const int      frontCellIndex  = zIndex + neighbourOffset;
-
-        // Back-Top-Left Cell Neighbour - 7
-        CheckNeighbourState(leftCellIndex, 
-                            aboveCellIndex, 
-                            backCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Back-Top-Middle Cell Neighbour - 8
-        CheckNeighbourState(xIndex, 
-                            aboveCellIndex, 
-                            backCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Back-Top-Right Cell Neighbour - 9
-        CheckNeighbourState(rightCellIndex, 
-                            aboveCellIndex, 
-                            backCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Back-Middle-Left Cell Neighbour - 10
-        CheckNeighbourState(leftCellIndex, 
-                            yIndex, 
-                            backCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Back-Middle-Right Cell Neighbour - 11
-        CheckNeighbourState(rightCellIndex, 
-                            yIndex, 
-                            backCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Back-Bottom-Left Cell Neighbour - 12
-        CheckNeighbourState(leftCellIndex, 
-                            belowCellIndex, 
-                            backCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Back-Bottom-Middle Cell Neighbour - 13
-        CheckNeighbourState(xIndex, 
-                            belowCellIndex, 
-                            backCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Back-Bottom-Right Cell Neighbour - 14
-        CheckNeighbourState(rightCellIndex, 
-                            belowCellIndex, 
-                            backCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Middle-Top-Left - 15
-        CheckNeighbourState(leftCellIndex, 
-                            aboveCellIndex, 
-                            zIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Middle-Top-Right - 16
-        CheckNeighbourState(rightCellIndex, 
-                            aboveCellIndex, 
-                            zIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Middle-Bottom-Left - 17
-        CheckNeighbourState(leftCellIndex, 
-                            belowCellIndex, 
-                            zIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Middle-Bottom-Right - 18
-        CheckNeighbourState(rightCellIndex, 
-                            belowCellIndex, 
-                            zIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Front-Top-Left Cell Neighbour - 19
-        CheckNeighbourState(leftCellIndex, 
-                            aboveCellIndex, 
-                            frontCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Front-Top-Middle Cell Neighbour - 20
-        CheckNeighbourState(xIndex, 
-                            aboveCellIndex, 
-                            frontCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Front-Top-Right Cell Neighbour - 21
-        CheckNeighbourState(rightCellIndex, 
-                            aboveCellIndex, 
-                            frontCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Front-Middle-Left Cell Neighbour - 22
-        CheckNeighbourState(leftCellIndex, 
-                            yIndex, 
-                            frontCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Front-Middle-Right Cell Neighbour - 23
-        CheckNeighbourState(rightCellIndex, 
-                            yIndex, 
-                            frontCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Front-Bottom-Left Cell Neighbour - 24
-        CheckNeighbourState(leftCellIndex, 
-                            belowCellIndex, 
-                            frontCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Front-Bottom-Middle Cell Neighbour - 25
-        CheckNeighbourState(xIndex, 
-                            belowCellIndex, 
-                            frontCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
-
-        // Front-Bottom-Right Cell Neighbour - 26
-        CheckNeighbourState(rightCellIndex, 
-                            belowCellIndex, 
-                            frontCellIndex, 
-                            gridDimensions, 
-                            pCellStates, 
-                            rLiveNeighbourCount);
+        // Sums a single column through the 3x3 block of rows (including the cell itself)
+        const auto SumColumn = [&](const int xIndex)
+        {
+            NeighbourCount_t columnCount(0U);
+
+            for (uint32_t i(0U); i < neighbourRowCount; ++i)
+            {
+                columnCount += ppNeighbourRows[i][xIndex];
+            }
+
+            return columnCount;
+        };
+
+        // Slide a window of three columns along the row, so each column 
+        // is only summed once rather than once per neighbouring cell
+        NeighbourCount_t previousColumnCount(0U);
+        NeighbourCount_t currentColumnCount = SumColumn(0);
+
+        for (int xIndex(0); xIndex < rowWidth; ++xIndex)
+        {
+            const NeighbourCount_t nextColumnCount    = (xIndex + 1 < rowWidth) ? SumColumn(xIndex + 1) : 0U;
+            const bool             isCellAlive        = pRow[xIndex];
+            const NeighbourCount_t liveNeighbourCount = previousColumnCount + currentColumnCount + nextColumnCount - isCellAlive;
+
+            pNextRow[xIndex] = IsCellAliveNextGeneration(isCellAlive, liveNeighbourCount);
+
+            previousColumnCount = currentColumnCount;
+            currentColumnCount  = nextColumnCount;
+        }
     }
 
-    void GameOfLifeSystem::CheckNeighbourState(const int xIndex,
-                                               const int yIndex, 
-                                               const int zIndex, 
-                                               const glm::uvec3& gridDimensions, 
-                                               const bool* pCellStates, 
-                                               NeighbourCount_t& rLiveNeighbourCount)
+    inline void GameOfLifeSystem::StepRowVonNeumann(const bool* const* ppNeighbourRows,
+                                                    const uint32_t neighbourRowCount, 
+                                                    const bool* pRow, 
+                                                    bool* pNextRow, 
+                                                    const int rowWidth) const
     {
-        const int neighbourIndex = 
-            _3DTo1DIndex(xIndex, 
-                         yIndex, 
-                         zIndex, 
-                         gridDimensions);
+        for (int xIndex(0); xIndex < rowWidth; ++xIndex)
+        {
+            NeighbourCount_t liveNeighbourCount(0U);
+
+            // Left & Right
+            liveNeighbourCount += (xIndex > 0)            ? pRow[xIndex - 1] : 0U;
+            liveNeighbourCount += (xIndex + 1 < rowWidth) ? pRow[xIndex + 1] : 0U;
 
-        if (neighbourIndex == -1)
+            // Above, Below, Back & Front
+            for (uint32_t i(0U); i < neighbourRowCount; ++i)
+            {
+                liveNeighbourCount += ppNeighbourRows[i][xIndex];
+            }
+
+            pNextRow[xIndex] = IsCellAliveNextGeneration(pRow[xIndex], liveNeighbourCount);
+        }
+    }
+
+    inline bool GameOfLifeSystem::IsCellAliveNextGeneration(const bool isCellAlive, 
+                                                            const NeighbourCount_t liveNeighbourCount) const
+    {
+        // Nothing to do - guarenteed dead
+        if (liveNeighbourCount == 0)
         {
-            return;
+            return false;
         }
 
-        // Is this cell alive?
-        if (!pCellStates[neighbourIndex])
+        if (isCellAlive)
         {
+            return !(liveNeighbourCount < _rGameOfLifeSettings.underpopulationCount ||   // Any live cell with fewer than underpopulationCount live neighbours dies, as if by underpopulation.
+                     liveNeighbourCount > _rGameOfLifeSettings.overpopulationCount);     // Any live cell with more than overpopulationCount live neighbours dies, as if by overpopulation.
+        }
+
+        // Any dead cell with exactly reproductionLiveNeighbourCount live neighbours becomes a live cell, as if by reproduction.
+        return liveNeighbourCount == _rGameOfLifeSettings.reproductionCount;
+    }
+
+    void GameOfLifeSystem::StepGenerations()
+    {
+        if (IsComputeBackendActive())
+        {
+            StepGenerationsOnDevice();
+
             return;
         }
 
-        ++rLiveNeighbourCount;
+        // Carry on from where the last GPU Compute batch got to
+        if (_rComputeBackend.IsBatchInFlight())
+        {
+            ReadBackDeviceGenerations(true);
+        }
+
+        const bool  isFastForwardEnabled = _rSimulationSettings.isFastForwardEnabled;
+        const float speed                = _rSimulationSettings.speed;
+
+        SolClock stepClock;
+
+        // Catch up on every generation that is due, as long as it fits within the time budget.
+        // Speeds shorter than the frame time now run multiple generations a frame instead of being capped.
+        do
+        {
+            NextGeneration();
+
+            if (!isFastForwardEnabled)
+            {
+                _nextGenerationDelayRemaining += speed;
+            }
+
+            stepClock.Restart();
+        } 
+        while ((isFastForwardEnabled || _nextGenerationDelayRemaining <= 0.f) && 
+               stepClock.GetTotalTime() < STEP_TIME_BUDGET_SECONDS);
+
+        // Drop whatever couldn't be afforded this frame, 
+        // otherwise we'd fall further behind every frame
+        _nextGenerationDelayRemaining = fmaxf(_nextGenerationDelayRemaining, 0.f);
+
+        // GPU Compute can't carry on from its own cells any more
+        _rComputeBackend.MarkHostCellStatesChanged();
+
+        // Only the final generation of the batch is worth marching
+        onUpdateAllCellStatesEvent.Invoke();
     }
 
     void GameOfLifeSystem::NextGeneration()
     {
-        UpdateAllCellStates();                  // Update all cell states to the next generation
-        CheckAllCellNeighbours();               // Check what state they will be in the generation after
-        ResetNextGenerationDelayRemaining();
+        StepAllCellStates();                    // Count neighbours and apply the rules in a single sweep into the back buffer
+        _rSolGrid.cells.SwapCellStates();       // Next generation becomes the current generation
 
         ++_rSimulationSettings.generation;
+        ++_generationsPerSecondSampleCount;
+
+        onGenerationSteppedEvent.Invoke();
+    }
+
+    void GameOfLifeSystem::StepGenerationsOnDevice()
+    {
+        // One batch at a time, the due generations go in the next one
+        if (_rComputeBackend.IsBatchInFlight())
+        {
+            return;
+        }
+
+        const float speed = _rSimulationSettings.speed;
+
+        // With no delay between generations, every one is always due
+        _isComputeBatchBudgetLimited = _rSimulationSettings.isFastForwardEnabled || speed <= 0.f;
+
+        // The delay has run out, so at least one generation is due
+        const uint32_t generationCount = _isComputeBatchBudgetLimited ? _computeBatchGenerationCount 
+                                                                      : (std::min)(1U + (uint32_t)(-_nextGenerationDelayRemaining / speed), 
+                                                                                   MAX_COMPUTE_BATCH_GENERATION_COUNT);
+
+#ifdef VALIDATE_COMPUTE_BACKEND
+        // The cells match the device's at the start of every batch, either read back or about to be uploaded
+        _isValidatingBatch = (++_computeBatchCount % VALIDATION_BATCH_INTERVAL) == 0U &&
+                             generationCount <= MAX_VALIDATED_GENERATION_COUNT;
+
+        if (_isValidatingBatch)
+        {
+            const glm::uvec3 gridDimensions = _rSolGrid.GetDimensions();
+
+            _validationCellStates.resize((size_t)gridDimensions.x * gridDimensions.y * gridDimensions.z);
+
+            std::memcpy(_validationCellStates.data(), 
+                        _rSolGrid.cells.pCellStates, 
+                        _validationCellStates.size());
+        }
+#endif  // VALIDATE_COMPUTE_BACKEND
+
+        _rComputeBackend.SubmitGenerations(generationCount);
+
+        if (!_isComputeBatchBudgetLimited)
+        {
+            _nextGenerationDelayRemaining = fmaxf(_nextGenerationDelayRemaining + speed * generationCount, 0.f);
+        }
+    }
+
+    void GameOfLifeSystem::ReadBackDeviceGenerations(const bool isWaitRequired)
+    {
+        uint32_t generationCount(0U);
+        float    computeTime(0.f);
+
+        // Still running, or thrown away as the cells were edited
+        if (!_rComputeBackend.ReadBackGenerations(isWaitRequired, 
+                                                  generationCount, 
+                                                  computeTime))
+        {
+            return;
+        }
+
+#ifdef VALIDATE_COMPUTE_BACKEND
+        if (_isValidatingBatch)
+        {
+            ValidateComputeGenerations(generationCount);
+        }
+#endif  // VALIDATE_COMPUTE_BACKEND
+
+        // Generations cost the same each batch, so aim for a batch that fills the budget without going over.
+        // Only the GPU's time is measured, the readback and any validation are left out
+        if (_isComputeBatchBudgetLimited && 
+            computeTime >= 0.f)
+        {
+            if (computeTime < STEP_TIME_BUDGET_SECONDS * 0.5f)
+            {
+                _computeBatchGenerationCount = (std::min)(_computeBatchGenerationCount * 2U, MAX_COMPUTE_BATCH_GENERATION_COUNT);
+            }
+            else if (computeTime > STEP_TIME_BUDGET_SECONDS)
+            {
+                _computeBatchGenerationCount = (std::max)(_computeBatchGenerationCount / 2U, 1U);
+            }
+        }
+
+        _rSimulationSettings.generation  += generationCount;
+        _generationsPerSecondSampleCount += generationCount;
+
+        // Only the final generation made it back to the CPU
+        onUpdateAllCellStatesEvent.Invoke();
+    }
+
+    bool GameOfLifeSystem::IsComputeBackendActive() const
+    {
+        return _rSimulationSettings.backend == SimulationBackend::GPU_COMPUTE &&
+               _rComputeBackend.IsAvailable() &&
+               !_isEveryGenerationRequired;
+    }
+
+    bool GameOfLifeSystem::AreCellStatesMatchingHost(const std::vector<uint8_t>& startCellStates, 
+                                                     const uint32_t generationCount)
+    {
+        const size_t cellCount = startCellStates.size();
+
+        // Put the GPU's cells aside, then step the same generations on the CPU from where they started
+        std::vector<uint8_t> deviceCellStates(cellCount);
+
+        std::memcpy(deviceCellStates.data(), 
+                    _rSolGrid.cells.pCellStates, 
+                    cellCount);
+
+        std::memcpy(_rSolGrid.cells.pCellStates, 
+                    startCellStates.data(), 
+                    cellCount);
+
+        for (uint32_t generation(0U); generation < generationCount; ++generation)
+        {
+            StepAllCellStates();
+            _rSolGrid.cells.SwapCellStates();
+        }
+
+        return std::memcmp(_rSolGrid.cells.pCellStates, 
+                           deviceCellStates.data(), 
+                           cellCount) == 0;
+    }
+
+    bool GameOfLifeSystem::RunComputeSelfTest(const uint32_t generationCount)
+    {
+        if (!_rComputeBackend.IsAvailable())
+        {
+            printf_s("Compute self test failed, GPU Compute is unavailable.\n");
+
+            return false;
+        }
+
+        // Anything still running is of no use
+        _rComputeBackend.MarkHostCellStatesChanged();
+        ReadBackDeviceGenerations(true);
+
+        const NeighbourhoodType neighbourhoodType = _rGameOfLifeSettings.neighbourhoodType;
+        const glm::uvec3        gridDimensions    = _rSolGrid.GetDimensions();
+
+        std::vector<uint8_t> startCellStates((size_t)gridDimensions.x * gridDimensions.y * gridDimensions.z);
+
+        bool isEveryNeighbourhoodMatching(true);
+
+        for (const NeighbourhoodType testedNeighbourhoodType : { NeighbourhoodType::MOORE, NeighbourhoodType::VON_NEUMANN })
+        {
+            _rGameOfLifeSettings.neighbourhoodType = testedNeighbourhoodType;
+
+            _rSolGrid.Reset();
+
+            std::memcpy(startCellStates.data(), 
+                        _rSolGrid.cells.pCellStates, 
+                        startCellStates.size());
+
+            // Always uploaded, so both backends start from the same cells
+            _rComputeBackend.MarkHostCellStatesChanged();
+            _rComputeBackend.SubmitGenerations(generationCount);
+
+            uint32_t readBackGenerationCount(0U);
+            float    computeTime(0.f);
+
+            const bool isReadBack = _rComputeBackend.ReadBackGenerations(true, 
+                                                                         readBackGenerationCount, 
+                                                                         computeTime);
+
+            const bool isMatching = isReadBack && 
+                                    AreCellStatesMatchingHost(startCellStates, generationCount);
+
+            printf_s("Compute self test %s: %u generations, %s neighbourhood, %ux%ux%u cells.\n",
+                     isMatching ? "passed" : "FAILED",
+                     generationCount,
+                     (testedNeighbourhoodType == NeighbourhoodType::MOORE) ? "Moore" : "Von Neumann",
+                     gridDimensions.x,
+                     gridDimensions.y,
+                     gridDimensions.z);
+
+            isEveryNeighbourhoodMatching &= isMatching;
+        }
+
+        _rGameOfLifeSettings.neighbourhoodType = neighbourhoodType;
+
+        _rSolGrid.Reset();
+        _rComputeBackend.MarkHostCellStatesChanged();
+
+        return isEveryNeighbourhoodMatching;
+    }
+
+#ifdef VALIDATE_COMPUTE_BACKEND
+    void GameOfLifeSystem::ValidateComputeGenerations(const uint32_t generationCount)
+    {
+        const bool isDeviceMatchingHost = AreCellStatesMatchingHost(_validationCellStates, 
+                                                                    generationCount);
+
+        DBG_ASSERT_MSG(isDeviceMatchingHost, 
+                       "GPU Compute generations don't match the CPU's!\n");
+    }
+#endif  // VALIDATE_COMPUTE_BACKEND
+
+    void GameOfLifeSystem::UpdateGenerationsPerSecond(const float deltaTime)
+    {
+        _generationsPerSecondSampleTime += deltaTime;
+
+        if (_generationsPerSecondSampleTime < GENERATIONS_PER_SECOND_SAMPLE_TIME)
+        {
+            return;
+        }
+
+        _rDiagnosticData.generationsPerSecond = _generationsPerSecondSampleCount / _generationsPerSecondSampleTime;
+
+        _generationsPerSecondSampleTime  = 0.f;
+        _generationsPerSecondSampleCount = 0U;
     }
-}
\ No newline at end of file
+}
@@ -1,8 +1,14 @@
 #pragma once
+#if _DEBUG
+#define VALIDATE_COMPUTE_BACKEND    // Re-steps a sample of the GPU Compute batches on the CPU and asserts the cells match
+#endif
+
 #include "SolGrid.hpp"
+#include "SolClock.hpp"
 #include "SolEvent.hpp"
 #include "GameOfLifeSettings.hpp"
 #include "SimulationSettings.hpp"
+#include "GameOfLifeComputeBackend.hpp"
 
 using namespace SolEngine::Events;
 using namespace SolEngine::Settings;
@@ -12,35 +18,95 @@ namespace SolEngine::System
     class GameOfLifeSystem
     {
     public:
-        GameOfLifeSystem(SolGrid& rSolGrid, GameOfLifeSettings& rGameOfLifeSettings, SimulationSettings& rSimulationSettings);
-
-        void CheckAllCellNeighbours();
-        void UpdateAllCellStates();
+        GameOfLifeSystem(SolGrid& rSolGrid, GameOfLifeComputeBackend& rComputeBackend, GameOfLifeSettings& rGameOfLifeSettings, 
+                         SimulationSettings& rSimulationSettings, DiagnosticData& rDiagnosticData);
 
         void Update(const float deltaTime);
         void ResetNextGenerationDelayRemaining();
 
+        /// <summary>
+        /// GPU Compute batches only bring the last generation back to the CPU, so whilst every generation is required the CPU steps them instead.
+        /// </summary>
+        void SetEveryGenerationRequired(const bool isEveryGenerationRequired) { _isEveryGenerationRequired = isEveryGenerationRequired; }
+
+        /// <summary>
+        /// The cells were changed outside of the simulation (Reset, Checkpoints, Playback), so GPU Compute has to start again from them.
+        /// </summary>
+        void MarkCellStatesEdited() { _rComputeBackend.MarkHostCellStatesChanged(); }
+
+        /// <summary>
+        /// Seeds the grid, steps the same generations on the CPU and with GPU Compute, then compares them for each neighbourhood.
+        /// Needs no input, so it can run headless, e.g. under lavapipe. Leaves the grid freshly reset.
+        /// </summary>
+        /// <returns>True if every generation matched.</returns>
+        bool RunComputeSelfTest(const uint32_t generationCount);
+
         SolEvent<> onUpdateAllCellStatesEvent;
+        SolEvent<> onGenerationSteppedEvent;       // Raised for every generation stepped on the CPU, unlike onUpdateAllCellStatesEvent which is once per batch
 
     private:
-        inline void CheckAdjacentNeighbourStates(const int xIndex, const int yIndex, const int zIndex, 
-                                                 const glm::uvec3& gridDimensions, const bool* pCellStates, 
-                                                 NeighbourCount_t& rLiveNeighbourCount);
+        static constexpr uint32_t NEIGHBOUR_ROWS_COUNT_MAX          { 9U };             // 3x3 block of rows surrounding (and including) the current row
+        static constexpr float    STEP_TIME_BUDGET_SECONDS          { 1.f / 120.f };    // Max time spent stepping generations each frame
+        static constexpr float    GENERATIONS_PER_SECOND_SAMPLE_TIME{ 0.5f };           // How often the generations/second diagnostic is refreshed
+        static constexpr uint32_t MAX_COMPUTE_BATCH_GENERATION_COUNT{ 1024U };          // Most generations dispatched before the cells are read back
+#ifdef VALIDATE_COMPUTE_BACKEND
+        static constexpr uint32_t VALIDATION_BATCH_INTERVAL         { 60U };            // Only every nth batch is re-stepped on the CPU...
+        static constexpr uint32_t MAX_VALIDATED_GENERATION_COUNT    { 16U };            // ...and only if it's short, so fast forward doesn't stall Debug
+#endif  // VALIDATE_COMPUTE_BACKEND
+
+        void StepAllCellStates();
 
-        inline void CheckDiagonalNeighbourStates(const int xIndex, const int yIndex, const int zIndex,
-                                                 const glm::uvec3& gridDimensions, const bool* pCellStates,
-                                                 NeighbourCount_t& rLiveNeighbourCount);
+        inline void StepRowMoore(const bool* const* ppNeighbourRows, const uint32_t neighbourRowCount, 
+                                 const bool* pRow, bool* pNextRow, const int rowWidth) const;
 
-        void CheckNeighbourState(const int xIndex, const int yIndex, const int zIndex,
-                                 const glm::uvec3& gridDimensions, const bool* pCellStates, 
-                                 NeighbourCount_t& rLiveNeighbourCount);
+        inline void StepRowVonNeumann(const bool* const* ppNeighbourRows, const uint32_t neighbourRowCount, 
+                                      const bool* pRow, bool* pNextRow, const int rowWidth) const;
 
+        inline bool IsCellAliveNextGeneration(const bool isCellAlive, const NeighbourCount_t liveNeighbourCount) const;
+
+        void StepGenerations();
         void NextGeneration();
 
-        float _nextGenerationDelayRemaining;
+        /// <summary>
+        /// Submits every generation that's due as one GPU Compute batch, once the last batch has been read back. 
+        /// Fast forwarding grows or shrinks the batch to fit the step time budget.
+        /// </summary>
+        void StepGenerationsOnDevice();
+
+        /// <summary>
+        /// Brings the finished batch's generation into the cells, see GameOfLifeComputeBackend::ReadBackGenerations.
+        /// </summary>
+        void ReadBackDeviceGenerations(const bool isWaitRequired);
+        bool IsComputeBackendActive() const;
+
+        /// <summary>
+        /// Compares the cells against stepping generationCount generations on the CPU from startCellStates.
+        /// The CPU's generation is left in the cells.
+        /// </summary>
+        bool AreCellStatesMatchingHost(const std::vector<uint8_t>& startCellStates, const uint32_t generationCount);
+
+#ifdef VALIDATE_COMPUTE_BACKEND
+        void ValidateComputeGenerations(const uint32_t generationCount);
+#endif  // VALIDATE_COMPUTE_BACKEND
+        void UpdateGenerationsPerSecond(const float deltaTime);
+
+        float    _nextGenerationDelayRemaining;
+        float    _generationsPerSecondSampleTime  { 0.f };
+        uint32_t _generationsPerSecondSampleCount { 0U };
+        uint32_t _computeBatchGenerationCount     { 1U };      // Fast forward only
+        bool     _isComputeBatchBudgetLimited     { false };   // Of the batch in flight
+        bool     _isEveryGenerationRequired       { false };
+
+#ifdef VALIDATE_COMPUTE_BACKEND
+        std::vector<uint8_t> _validationCellStates{};       // Cells at the start of the sampled GPU Compute batch
+        uint32_t             _computeBatchCount   { 0U };
+        bool                 _isValidatingBatch   { false };
+#endif  // VALIDATE_COMPUTE_BACKEND
 
-        SolGrid&            _rSolGrid;
-        GameOfLifeSettings& _rGameOfLifeSettings;
-        SimulationSettings& _rSimulationSettings;
+        SolGrid&                  _rSolGrid;
+        GameOfLifeComputeBackend& _rComputeBackend;
+        GameOfLifeSettings&       _rGameOfLifeSettings;
+        SimulationSettings&       _rSimulationSettings;
+        DiagnosticData&           _rDiagnosticData;
     };
 }
@@ -0,0 +1,196 @@
+#include "GenerationPlayer.hpp"
+
+namespace SolEngine::System
+{
+    GenerationPlayer::GenerationPlayer(SolGrid& rSolGrid, 
+                                       GridSettings& rGridSettings,
+                                       SimulationSettings& rSimulationSettings)
+        : _rSolGrid(rSolGrid),
+          _rGridSettings(rGridSettings),
+          _rSimulationSettings(rSimulationSettings)
+    {}
+
+    bool GenerationPlayer::Open(const std::string& filePath)
+    {
+        Close();
+
+        _pMappedFile = std::make_unique<SolMappedFile>(filePath);
+
+        if (!_pMappedFile->IsValid() || !IndexFrames())
+        {
+            printf_s("Failed to open recording: %s\n", filePath.c_str());
+
+            Close();
+
+            return false;
+        }
+
+        const glm::uvec3 dimensions(_header.dimensions[0], 
+                                    _header.dimensions[1], 
+                                    _header.dimensions[2]);
+
+        // Only rebuild the grid when the size actually changes
+        if (_rGridSettings.dimensions != dimensions)
+        {
+            _rGridSettings.dimensions = dimensions;
+            _rSolGrid.Initialise();
+        }
+
+        const size_t packedSize = CellStateCodec::GetPackedSizeBytes(_header.cellCount);
+
+        _packedStates.resize(packedSize);
+        _deltaStates.resize(packedSize);
+
+        printf_s("Opened recording of generations %zu to %zu: %s\n", GetFirstGeneration(), GetLastGeneration(), filePath.c_str());
+
+        return true;
+    }
+
+    void GenerationPlayer::Close()
+    {
+        _pMappedFile       = nullptr;
+        _header            = {};
+        _frames            = {};
+        _packedStates      = {};
+        _deltaStates       = {};
+        _currentFrameIndex = INVALID_FRAME_INDEX;
+    }
+
+    bool GenerationPlayer::Seek(const size_t generation)
+    {
+        if (!IsOpen() || 
+            generation < GetFirstGeneration() || 
+            generation > GetLastGeneration())
+        {
+            return false;
+        }
+
+        const size_t targetFrameIndex = generation - GetFirstGeneration();
+        size_t       keyframeIndex(targetFrameIndex);
+
+        while (!_frames[keyframeIndex].isKeyframe)
+        {
+            --keyframeIndex;
+        }
+
+        // Carry on from where we are if it's between the keyframe and the target, 
+        // scrubbing forwards then only costs the frames in-between
+        const bool isContinuingFromCurrentFrame = _currentFrameIndex != INVALID_FRAME_INDEX &&
+                                                  _currentFrameIndex >= keyframeIndex       && 
+                                                  _currentFrameIndex <= targetFrameIndex;
+
+        const size_t firstFrameIndex = isContinuingFromCurrentFrame ? _currentFrameIndex + 1U : keyframeIndex;
+
+        for (size_t i = firstFrameIndex; i <= targetFrameIndex; ++i)
+        {
+            if (!ApplyFrame(i))
+            {
+                printf_s("Recording has a corrupt frame at generation %zu\n", GetFirstGeneration() + i);
+
+                _currentFrameIndex = INVALID_FRAME_INDEX;
+
+                return false;
+            }
+        }
+
+        _currentFrameIndex = targetFrameIndex;
+
+        CellStateCodec::UnpackStates(_packedStates.data(), 
+                                     _header.cellCount, 
+                                     _rSolGrid.cells.pCellStates);
+
+        _rSimulationSettings.generation = generation;
+
+        return true;
+    }
+
+    bool GenerationPlayer::IndexFrames()
+    {
+        const uint8_t* pFileData = _pMappedFile->GetData();
+        const size_t   fileSize  = _pMappedFile->GetSize();
+
+        if (fileSize < sizeof(RecordingHeader))
+        {
+            return false;
+        }
+
+        memcpy(&_header, pFileData, sizeof(RecordingHeader));
+
+        if (_header.magic != RecordingHeader::MAGIC || 
+            _header.version != RecordingHeader::VERSION)
+        {
+            return false;
+        }
+
+        for (const uint32_t axisSize : _header.dimensions)
+        {
+            if (axisSize < MIN_CELLS_PER_AXIS_COUNT || 
+                axisSize > MAX_CELLS_PER_AXIS_COUNT)
+            {
+                return false;
+            }
+        }
+
+        if (_header.cellCount != (size_t)_header.dimensions[0] * _header.dimensions[1] * _header.dimensions[2])
+        {
+            return false;
+        }
+
+        // Walk the frame headers, the recorder writes exactly one frame per generation
+        size_t offset(sizeof(RecordingHeader));
+
+        while (offset + sizeof(RecordingFrameHeader) <= fileSize)
+        {
+            RecordingFrameHeader frameHeader{};
+            memcpy(&frameHeader, pFileData + offset, sizeof(RecordingFrameHeader));
+
+            const size_t dataOffset     = offset + sizeof(RecordingFrameHeader);
+            const bool   isFrameInOrder = frameHeader.generation == _header.firstGeneration + _frames.size();
+            const bool   isFrameWhole   = dataOffset + frameHeader.compressedSizeBytes <= fileSize;
+
+            // Stop at the first frame that can't be trusted, everything before it is still usable
+            if (!isFrameInOrder || !isFrameWhole)
+            {
+                break;
+            }
+
+            _frames.push_back({ dataOffset, frameHeader.compressedSizeBytes, frameHeader.isKeyframe != 0U });
+
+            offset = dataOffset + frameHeader.compressedSizeBytes;
+        }
+
+        // Nothing to decode from without a leading keyframe
+        return !_frames.empty() && _frames.front().isKeyframe;
+    }
+
+    bool GenerationPlayer::ApplyFrame(const size_t frameIndex)
+    {
+        const Frame&   frame      = _frames[frameIndex];
+        const uint8_t* pFrameData = _pMappedFile->GetData() + frame.dataOffset;
+
+        if (frame.isKeyframe)
+        {
+            return CellStateCodec::Decompress(pFrameData, 
+                                              frame.compressedSizeBytes, 
+                                              _packedStates.data(), 
+                                              _packedStates.size());
+        }
+
+        if (!CellStateCodec::Decompress(pFrameData, 
+                                        frame.compressedSizeBytes, 
+                                        _deltaStates.data(), 
+                                        _deltaStates.size()))
+        {
+            return false;
+        }
+
+        // Flip every cell that changed since the previous generation
+        std::transform(_packedStates.begin(), 
+                       _packedStates.end(), 
+                       _deltaStates.begin(), 
+                       _packedStates.begin(), 
+                       std::bit_xor<uint8_t>());
+
+        return true;
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <memory>
+
+#include "SolGrid.hpp"
+#include "SolMappedFile.hpp"
+#include "CellStateCodec.hpp"
+#include "RecordingHeader.hpp"
+#include "SimulationSettings.hpp"
+
+using namespace SolEngine::Data;
+using namespace SolEngine::Settings;
+
+namespace SolEngine::System
+{
+    /// <summary>
+    /// Plays back a recording made by the GenerationRecorder. Any recorded generation can be 
+    /// restored into the grid by decoding forwards from the nearest keyframe before it.
+    /// </summary>
+    class GenerationPlayer
+    {
+    public:
+        GenerationPlayer(SolGrid& rSolGrid, GridSettings& rGridSettings, SimulationSettings& rSimulationSettings);
+
+        /// <summary>
+        /// Opens a recording and indexes its frames. The grid is re-initialised when the dimensions differ.
+        /// A frame cut short by the recorder not finishing is ignored.
+        /// </summary>
+        bool Open(const std::string& filePath);
+        void Close();
+
+        /// <summary>
+        /// Restores the cell states and generation count of a recorded generation.
+        /// </summary>
+        bool Seek(const size_t generation);
+
+        bool   IsOpen()             const { return _pMappedFile != nullptr; }
+        size_t GetFirstGeneration() const { return _header.firstGeneration; }
+        size_t GetLastGeneration()  const { return _header.firstGeneration + _frames.size() - 1U; }
+
+    private:
+        static constexpr size_t INVALID_FRAME_INDEX{ SIZE_MAX };
+
+        struct Frame
+        {
+            size_t   dataOffset;
+            uint32_t compressedSizeBytes;
+            bool     isKeyframe;
+        };
+
+        bool IndexFrames();
+        bool ApplyFrame(const size_t frameIndex);
+
+        SolGrid&            _rSolGrid;
+        GridSettings&       _rGridSettings;
+        SimulationSettings& _rSimulationSettings;
+
+        std::unique_ptr<SolMappedFile> _pMappedFile{ nullptr };
+        RecordingHeader                _header{};
+        std::vector<Frame>             _frames;
+
+        std::vector<uint8_t> _packedStates;         // States of _currentFrameIndex, kept so seeking forwards only decodes the new frames
+        std::vector<uint8_t> _deltaStates;
+        size_t               _currentFrameIndex{ INVALID_FRAME_INDEX };
+    };
+}
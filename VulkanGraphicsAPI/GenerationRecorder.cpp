@@ -0,0 +1,144 @@
+#include "GenerationRecorder.hpp"
+
+namespace SolEngine::System
+{
+    GenerationRecorder::GenerationRecorder(SolGrid& rSolGrid, 
+                                           SimulationSettings& rSimulationSettings)
+        : _rSolGrid(rSolGrid),
+          _rSimulationSettings(rSimulationSettings)
+    {}
+
+    GenerationRecorder::~GenerationRecorder()
+    {
+        Stop();
+    }
+
+    bool GenerationRecorder::Start(const std::string& filePath, 
+                                   const uint32_t keyframeInterval)
+    {
+        Stop();
+
+        const std::filesystem::path recordingPath(filePath);
+        std::error_code             errorCode{};
+
+        if (recordingPath.has_parent_path())
+        {
+            std::filesystem::create_directories(recordingPath.parent_path(), errorCode);
+        }
+
+        _file.open(recordingPath, std::ios::binary | std::ios::trunc);
+
+        if (!_file.is_open())
+        {
+            printf_s("Failed to open recording for writing: %s\n", filePath.c_str());
+
+            return false;
+        }
+
+        // MSVC's filebuf ignores a buffer set before the file is open, so set it after, before the first write
+        _fileBuffer.resize(FILE_BUFFER_SIZE_BYTES);
+        _file.rdbuf()->pubsetbuf(_fileBuffer.data(), _fileBuffer.size());
+
+        const glm::uvec3 gridDimensions = _rSolGrid.GetDimensions();
+
+        _cellCount           = (size_t)gridDimensions.x * gridDimensions.y * gridDimensions.z;
+        _keyframeInterval    = std::max(keyframeInterval, 1U);
+        _framesSinceKeyframe = _keyframeInterval;   // First frame is always a keyframe
+
+        const RecordingHeader header
+        {
+            .dimensions       = { gridDimensions.x, gridDimensions.y, gridDimensions.z },
+            .keyframeInterval = _keyframeInterval,
+            .cellCount        = _cellCount,
+            .firstGeneration  = _rSimulationSettings.generation
+        };
+
+        _file.write((const char*)&header, sizeof(RecordingHeader));
+
+        const size_t packedSize = CellStateCodec::GetPackedSizeBytes(_cellCount);
+
+        _packedStates.resize(packedSize);
+        _previousPackedStates.resize(packedSize);
+
+        RecordGeneration();
+
+        printf_s("Started recording at generation %zu: %s\n", _rSimulationSettings.generation, filePath.c_str());
+
+        return true;
+    }
+
+    void GenerationRecorder::Stop()
+    {
+        if (!_file.is_open())
+        {
+            return;
+        }
+
+        _file.close();
+
+        // Recordings can get large, don't hold on to the buffers
+        _fileBuffer           = {};
+        _packedStates         = {};
+        _previousPackedStates = {};
+        _compressedStates     = {};
+
+        printf_s("Stopped recording at generation %zu\n", _rSimulationSettings.generation);
+    }
+
+    void GenerationRecorder::RecordGeneration()
+    {
+        if (!_file.is_open())
+        {
+            return;
+        }
+
+        CellStateCodec::PackStates(_rSolGrid.cells.pCellStates, _cellCount, _packedStates.data());
+
+        if (_framesSinceKeyframe >= _keyframeInterval)
+        {
+            WriteFrame(_packedStates, true);
+
+            _framesSinceKeyframe = 0U;
+        }
+        else
+        {
+            // XOR against the last generation leaves only the flipped cells set. 
+            // Most of a grid is stable between generations, so this is mostly zeros and compresses to very little
+            std::transform(_previousPackedStates.begin(), 
+                           _previousPackedStates.end(), 
+                           _packedStates.begin(), 
+                           _previousPackedStates.begin(), 
+                           std::bit_xor<uint8_t>());
+
+            WriteFrame(_previousPackedStates, false);
+        }
+
+        ++_framesSinceKeyframe;
+
+        // This generation becomes the reference for the next delta
+        std::swap(_packedStates, _previousPackedStates);
+    }
+
+    void GenerationRecorder::WriteFrame(const std::vector<uint8_t>& states, 
+                                        const bool isKeyframe)
+    {
+        _compressedStates.clear();
+
+        const RecordingFrameHeader frameHeader
+        {
+            .generation          = _rSimulationSettings.generation,
+            .compressedSizeBytes = (uint32_t)CellStateCodec::Compress(states.data(), states.size(), _compressedStates),
+            .isKeyframe          = isKeyframe ? 1U : 0U
+        };
+
+        _file.write((const char*)&frameHeader, sizeof(RecordingFrameHeader));
+        _file.write((const char*)_compressedStates.data(), _compressedStates.size());
+
+        if (!_file.good())
+        {
+            printf_s("Failed to write recording, stopping...\n");
+
+            Stop();
+        }
+    }
+}
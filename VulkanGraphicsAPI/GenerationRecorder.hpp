@@ -0,0 +1,60 @@
+#pragma once
+#include <filesystem>
+#include <fstream>
+
+#include "SolGrid.hpp"
+#include "CellStateCodec.hpp"
+#include "RecordingHeader.hpp"
+#include "SimulationSettings.hpp"
+
+using namespace SolEngine::Data;
+using namespace SolEngine::Settings;
+
+namespace SolEngine::System
+{
+    /// <summary>
+    /// Appends every generation to a recording as it is simulated.
+    /// Most frames only store what changed since the previous generation, 
+    /// with a full keyframe every keyframeInterval generations so playback can seek quickly.
+    /// </summary>
+    class GenerationRecorder
+    {
+    public:
+        static constexpr const char* RECORDING_FILE_PATH{ "Recordings/Simulation.solrec" };
+
+        GenerationRecorder(SolGrid& rSolGrid, SimulationSettings& rSimulationSettings);
+        ~GenerationRecorder();
+
+        /// <summary>
+        /// Starts a new recording, overwriting any existing file. The current generation is written as the first keyframe.
+        /// </summary>
+        bool Start(const std::string& filePath, const uint32_t keyframeInterval);
+        void Stop();
+
+        /// <summary>
+        /// Appends the current generation. Does nothing if not recording.
+        /// </summary>
+        void RecordGeneration();
+
+        bool IsRecording() const { return _file.is_open(); }
+
+    private:
+        static constexpr size_t FILE_BUFFER_SIZE_BYTES{ 1U << 20 };   // Batches the many small frame writes into fewer, larger ones
+
+        void WriteFrame(const std::vector<uint8_t>& states, const bool isKeyframe);
+
+        SolGrid&            _rSolGrid;
+        SimulationSettings& _rSimulationSettings;
+
+        std::ofstream     _file;
+        std::vector<char> _fileBuffer;
+
+        std::vector<uint8_t> _packedStates;
+        std::vector<uint8_t> _previousPackedStates;
+        std::vector<uint8_t> _compressedStates;
+
+        size_t   _cellCount          { 0U };
+        uint32_t _keyframeInterval   { 0U };
+        uint32_t _framesSinceKeyframe{ 0U };
+    };
+}
@@ -3,11 +3,17 @@
 namespace SolEngine::Rendering
 {
     GenericRenderSystem::GenericRenderSystem(SolDevice& rSolDevice,
+                                             SolShaderLibrary& rSolShaderLibrary,
                                              RenderSettings& rRenderSettings,
                                              const VkRenderPass renderPass)
         : _rSolDevice(rSolDevice),
+          _rSolShaderLibrary(rSolShaderLibrary),
           _rRenderSettings(rRenderSettings)
     {
+        // Built by compile_shaders.bat, until then Lit falls back to Unlit
+        _isLitShaderAvailable          = std::filesystem::exists(LIT_VERTEX_SHADER_PATH);
+        _isCubeInstanceShaderAvailable = std::filesystem::exists(CUBE_INSTANCE_SHADER_PATH);
+
         CreatePipelineLayout();
         CreatePipeline(renderPass);
     }
@@ -19,6 +25,12 @@ namespace SolEngine::Rendering
 
     void GenericRenderSystem::Dispose()
     {
+        // Can't pull the layout out from under pipelines still being built
+        if (_pipelineVariantsBuilt.valid())
+        {
+            _pipelineVariantsBuilt.wait();
+        }
+
         vkDestroyPipelineLayout(_rSolDevice.GetDevice(), 
                                 _pipelineLayout, 
                                 nullptr);
@@ -56,17 +68,146 @@ namespace SolEngine::Rendering
         DBG_ASSERT_MSG((_pipelineLayout != nullptr), 
                        "Cannot create Pipeline before Pipeline Layout.");
 
+        // The current settings are needed for the very first frame, so build that variant straight away
+        _initialPipelineVariantIndex = GetPipelineVariantIndex(_rRenderSettings.polygonMode, 
+                                                               _rRenderSettings.cullMode,
+                                                               _rRenderSettings.isLightingEnabled,
+                                                               IsInstancedMeshingSelected());
+
+        _pipelineVariants[_initialPipelineVariantIndex] = CreatePipelineVariant(renderPass, 
+                                                                                _rRenderSettings.polygonMode, 
+                                                                                _rRenderSettings.cullMode,
+                                                                                _rRenderSettings.isLightingEnabled,
+                                                                                IsInstancedMeshingSelected());
+
+        // Everything else compiles in the background, so switching modes later is just a lookup.
+        // Each variant has its own slot, so nothing is shared with the render thread apart from the pipeline cache (internally synchronised)
+        _pipelineVariantsBuilt = std::async(std::launch::async, 
+                                            [this, renderPass]()
+                                            {
+                                                for (size_t i = 0; i < PIPELINE_VARIANT_COUNT; ++i)
+                                                {
+                                                    const VkPolygonMode      polygonMode = (VkPolygonMode)((i / CULL_MODE_COUNT) % POLYGON_MODE_COUNT);
+                                                    const VkCullModeFlagBits cullMode    = (VkCullModeFlagBits)(i % CULL_MODE_COUNT);
+                                                    const size_t             shadingMode = i / (POLYGON_MODE_COUNT * CULL_MODE_COUNT);
+                                                    const bool               isLit       = shadingMode == 1U;
+                                                    const bool               isInstanced = shadingMode == 2U;
+
+                                                    // Skip the one we already have, and any that map onto another variant
+                                                    if (i == _initialPipelineVariantIndex || 
+                                                        i != GetPipelineVariantIndex(polygonMode, cullMode, isLit, isInstanced))
+                                                    {
+                                                        continue;
+                                                    }
+
+                                                    _pipelineVariants[i] = CreatePipelineVariant(renderPass, 
+                                                                                                 polygonMode, 
+                                                                                                 cullMode,
+                                                                                                 isLit,
+                                                                                                 isInstanced);
+                                                }
+                                            });
+    }
+
+    void GenericRenderSystem::BindPipeline(const VkCommandBuffer commandBuffer,
+                                           SolPipeline& rPipelineVariant) const
+    {
+        rPipelineVariant.Bind(commandBuffer);
+
+        if (_rSolDevice.IsExtendedDynamicStateEnabled())
+        {
+            _rSolDevice.CmdSetCullMode(commandBuffer, _rRenderSettings.cullMode);
+        }
+    }
+
+    SolPipeline& GenericRenderSystem::GetPipelineVariant() const
+    {
+        const size_t variantIndex = GetPipelineVariantIndex(_rRenderSettings.polygonMode, 
+                                                            _rRenderSettings.cullMode,
+                                                            _rRenderSettings.isLightingEnabled,
+                                                            IsInstancedMeshingSelected());
+
+        // Only the initial variant is guaranteed to exist, 
+        // the others may still be compiling if the settings are changed within the first moments
+        if (variantIndex != _initialPipelineVariantIndex)
+        {
+            _pipelineVariantsBuilt.wait();
+        }
+
+        return *_pipelineVariants[variantIndex];
+    }
+
+    std::unique_ptr<SolPipeline> GenericRenderSystem::CreatePipelineVariant(const VkRenderPass renderPass, 
+                                                                            const VkPolygonMode polygonMode,
+                                                                            const VkCullModeFlagBits cullMode,
+                                                                            const bool isLit,
+                                                                            const bool isInstanced) const
+    {
         PipelineConfigInfo pipelineConfigInfo{};
         SolPipeline::DefaultPipelineConfigInfo(pipelineConfigInfo);
 
         pipelineConfigInfo.renderPass                               = renderPass;
         pipelineConfigInfo.pipelineLayout                           = _pipelineLayout;
-        pipelineConfigInfo.rasterizationStateCreateInfo.cullMode    = _rRenderSettings.cullMode;
-        pipelineConfigInfo.rasterizationStateCreateInfo.polygonMode = _rRenderSettings.polygonMode;
+        pipelineConfigInfo.rasterizationStateCreateInfo.cullMode    = cullMode;
+        pipelineConfigInfo.rasterizationStateCreateInfo.polygonMode = polygonMode;
+
+        if (_rSolDevice.IsExtendedDynamicStateEnabled())
+        {
+            pipelineConfigInfo.dynamicStateEnables.push_back(VK_DYNAMIC_STATE_CULL_MODE_EXT);
+
+            // Vector may have moved, so point at it again
+            pipelineConfigInfo.dynamicStateCreateInfo.dynamicStateCount = static_cast<uint32_t>(pipelineConfigInfo.dynamicStateEnables.size());
+            pipelineConfigInfo.dynamicStateCreateInfo.pDynamicStates    = pipelineConfigInfo.dynamicStateEnables.data();
+        }
+
+        const char* vertexShaderPath = isLit ? LIT_VERTEX_SHADER_PATH : SIMPLE_VERTEX_SHADER_PATH;
+
+        if (isInstanced)
+        {
+            // The cube's vertices are read per vertex, the live cell it's drawn at per instance
+            const std::vector<VkVertexInputBindingDescription>   instanceBindingDescriptions  { CellInstance::InputBindingDescriptors() };
+            const std::vector<VkVertexInputAttributeDescription> instanceAttributeDescriptions{ CellInstance::InputAttributeDescriptions() };
+
+            pipelineConfigInfo.inputBindingDescriptions.insert(pipelineConfigInfo.inputBindingDescriptions.end(),
+                                                               instanceBindingDescriptions.begin(), 
+                                                               instanceBindingDescriptions.end());
+
+            pipelineConfigInfo.inputAttributeDescriptions.insert(pipelineConfigInfo.inputAttributeDescriptions.end(),
+                                                                 instanceAttributeDescriptions.begin(), 
+                                                                 instanceAttributeDescriptions.end());
+
+            vertexShaderPath = CUBE_INSTANCE_SHADER_PATH;
+        }
+
+        return std::make_unique<SolPipeline>(_rSolDevice,
+                                             _rSolShaderLibrary,
+                                             vertexShaderPath,
+                                             SIMPLE_FRAGMENT_SHADER_PATH,
+                                             pipelineConfigInfo);
+    }
+
+    size_t GenericRenderSystem::GetPipelineVariantIndex(const VkPolygonMode polygonMode, 
+                                                        const VkCullModeFlagBits cullMode,
+                                                        const bool isLit,
+                                                        const bool isInstanced) const
+    {
+        // Wireframe and Point need fillModeNonSolid, fall back to Fill without it
+        const bool   isPolygonModeSupported = polygonMode == VK_POLYGON_MODE_FILL || 
+                                              _rSolDevice.GetEnabledFeatures().fillModeNonSolid;
+        const size_t polygonModeIndex       = isPolygonModeSupported ? (size_t)polygonMode : (size_t)VK_POLYGON_MODE_FILL;
+
+        // Cull mode is set whilst recording when it's dynamic state, so one pipeline covers them all
+        const size_t cullModeIndex = _rSolDevice.IsExtendedDynamicStateEnabled() ? 0U : (size_t)cullMode;
+
+        // Lit variants come after every Unlit one, then Instanced Cubes after those.
+        // Instanced Cubes can only be selected when its shader is available, but don't build it otherwise
+        size_t shadingModeIndex = (isLit && _isLitShaderAvailable) ? 1U : 0U;
+
+        if (isInstanced && _isCubeInstanceShaderAvailable)
+        {
+            shadingModeIndex = 2U;
+        }
 
-        _pSolPipeline = std::make_unique<SolPipeline>(_rSolDevice,
-                                                      "Shaders/SimpleShader.vert.spv",
-                                                      "Shaders/SimpleShader.frag.spv",
-                                                      pipelineConfigInfo);
+        return (((shadingModeIndex * POLYGON_MODE_COUNT) + polygonModeIndex) * CULL_MODE_COUNT) + cullModeIndex;
     }
 }
\ No newline at end of file
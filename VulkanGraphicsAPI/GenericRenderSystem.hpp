@@ -1,10 +1,14 @@
 #pragma once
+#include <array>
+#include <future>
+
 #include "SolDevice.hpp"
 #include "SolGameObject.hpp"
 #include "SolPipeline.hpp"
 #include "SolCamera.hpp"
 #include "SimplePushConstantData.hpp"
 #include "RenderSettings.hpp"
+#include "CellInstance.hpp"
 
 using namespace SolEngine::Data;
 using namespace SolEngine::Settings;
@@ -15,19 +19,66 @@ namespace SolEngine::Rendering
 	{
 	public:
 		GenericRenderSystem() = delete;
-		GenericRenderSystem(SolDevice& rSolDevice, RenderSettings& rRenderSettings, const VkRenderPass renderPass);
+		GenericRenderSystem(SolDevice& rSolDevice, SolShaderLibrary& rSolShaderLibrary, RenderSettings& rRenderSettings, const VkRenderPass renderPass);
 		virtual ~GenericRenderSystem();
 
+		/// <summary>
+		/// False if Shaders/CubeInstanceShader.vert.spv hasn't been compiled, in which case Instanced Cubes can't be drawn.
+		/// </summary>
+		bool IsCubeInstanceShaderAvailable() const { return _isCubeInstanceShaderAvailable; }
+
 	protected:
+		static constexpr size_t POLYGON_MODE_COUNT	   { 3U };	// Fill, Line, Point
+		static constexpr size_t CULL_MODE_COUNT		   { 4U };	// None, Front, Back, Front and Back
+		static constexpr size_t SHADING_MODE_COUNT	   { 3U };	// Unlit, Lit, Instanced Cubes (Always Lit)
+		static constexpr size_t PIPELINE_VARIANT_COUNT { POLYGON_MODE_COUNT * CULL_MODE_COUNT * SHADING_MODE_COUNT };
+
+		static constexpr const char* SIMPLE_VERTEX_SHADER_PATH  { "Shaders/SimpleShader.vert.spv" };
+		static constexpr const char* SIMPLE_FRAGMENT_SHADER_PATH{ "Shaders/SimpleShader.frag.spv" };
+		static constexpr const char* LIT_VERTEX_SHADER_PATH     { "Shaders/LitShader.vert.spv" };	// Shares SimpleShader.frag
+		static constexpr const char* CUBE_INSTANCE_SHADER_PATH  { "Shaders/CubeInstanceShader.vert.spv" };	// Shares SimpleShader.frag
+
 		// Inherited via IDisposable
 		virtual void Dispose() override;
 
 		virtual void CreatePipelineLayout();
 		virtual void CreatePipeline(const VkRenderPass renderPass);
 
-		SolDevice&					 _rSolDevice;
-		RenderSettings&				 _rRenderSettings;
-		std::unique_ptr<SolPipeline> _pSolPipeline{ nullptr };
-		VkPipelineLayout             _pipelineLayout;
+		/// <summary>
+		/// Binds the pipeline variant matching the current render settings.
+		/// </summary>
+		void BindPipeline(const VkCommandBuffer commandBuffer) const { BindPipeline(commandBuffer, GetPipelineVariant()); }
+		void BindPipeline(const VkCommandBuffer commandBuffer, SolPipeline& rPipelineVariant) const;
+
+		/// <summary>
+		/// Returns the pipeline variant matching the current render settings, waiting for it if it's still compiling.
+		/// Call once before recording on several threads, as the wait isn't thread safe.
+		/// </summary>
+		SolPipeline& GetPipelineVariant() const;
+
+		SolDevice&		  _rSolDevice;
+		SolShaderLibrary& _rSolShaderLibrary;
+		RenderSettings&	  _rRenderSettings;
+		VkPipelineLayout  _pipelineLayout;
+
+	private:
+		std::unique_ptr<SolPipeline> CreatePipelineVariant(const VkRenderPass renderPass, const VkPolygonMode polygonMode, 
+														   const VkCullModeFlagBits cullMode, const bool isLit, const bool isInstanced) const;
+
+		/// <summary>
+		/// Variants that would be identical share an index, e.g. every cull mode when it is dynamic state.
+		/// </summary>
+		size_t GetPipelineVariantIndex(const VkPolygonMode polygonMode, const VkCullModeFlagBits cullMode, const bool isLit, const bool isInstanced) const;
+
+		/// <summary>
+		/// Instanced Cubes draw a cube per CellInstance, so need the per-instance binding.
+		/// </summary>
+		bool IsInstancedMeshingSelected() const { return _rRenderSettings.meshingAlgorithm == MeshingAlgorithm::INSTANCED_CUBES; }
+
+		std::array<std::unique_ptr<SolPipeline>, PIPELINE_VARIANT_COUNT> _pipelineVariants;
+		std::future<void>												  _pipelineVariantsBuilt;
+		size_t															  _initialPipelineVariantIndex  { 0U };
+		bool															  _isLitShaderAvailable         { false };
+		bool															  _isCubeInstanceShaderAvailable{ false };
 	};
 }
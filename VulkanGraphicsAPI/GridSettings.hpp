@@ -12,6 +12,13 @@ namespace SolEngine::Settings
 			dimensions = defaultGridSettings.dimensions;
 		}
 
+		void ResetLiveCellDensity()
+		{
+			GridSettings defaultGridSettings{};
+
+			liveCellDensity = defaultGridSettings.liveCellDensity;
+		}
+
 		size_t GetNodeCount() const 
 		{
 			return (size_t)((double)dimensions.x * dimensions.y * dimensions.z);
@@ -19,6 +26,7 @@ namespace SolEngine::Settings
 
 		bool isGridDimensionsChangeRequested{ false };
 
-		glm::uvec3 dimensions{ 30U };	// Adjusts the size of the grid
+		glm::uvec3 dimensions	  { 30U };	// Adjusts the size of the grid
+		float	   liveCellDensity{ 0.5f };	// Chance of each cell starting alive when the grid is seeded
 	};
 }
@@ -36,12 +36,25 @@ namespace SolEngine::GUI
                          MIN_DELTA_TIME_SCALE, 
                          MAX_DELTA_TIME_SCALE);
 
+        ImGui::Text("Generations/Second: %.1f", _rDiagnosticData.generationsPerSecond);
         ImGui::Text("Vert Count: %zu", _rDiagnosticData.vertexCount);
         ImGui::Text("Tri Count: %zu", _rDiagnosticData.triCount);
+        ImGui::Text("Chunks Culled: %zu/%zu (%zu Verts Drawn)", 
+                    _rDiagnosticData.culledChunkCount, 
+                    _rDiagnosticData.chunkCount,
+                    _rDiagnosticData.drawnVertexCount);
+        ImGui::Text("Chunks at Lower Detail: %zu", _rDiagnosticData.lowDetailChunkCount);
         ImGui::Text("In-use Memory (Bytes): %zu/%zu (%.3f%%)", 
                     _rDiagnosticData.GetTotalMemoryUsedBytes(), 
                     _rDiagnosticData.GetTotalMemoryAllocatedBytes(),
                     _rDiagnosticData.GetMemoryUsedPercentage());
+        ImGui::Text("Device Memory (Bytes): %zu/%zu (%.3f%%)", 
+                    _rDiagnosticData.deviceMemoryUsedBytes, 
+                    _rDiagnosticData.deviceMemoryAllocatedBytes,
+                    _rDiagnosticData.GetDeviceMemoryUsedPercentage());
+        ImGui::Text("Device Allocations: %zu in %zu Blocks", 
+                    _rDiagnosticData.deviceMemoryAllocationCount, 
+                    _rDiagnosticData.deviceMemoryBlockCount);
 
         ImGui::End();
     }
@@ -8,6 +8,10 @@ namespace SolEngine::GUI::View
 		  _rSimulationSettings(rSimulationSettings)
 	{
 		InitGuiGridDimensions();
+
+		_guiLiveCellDensity = _rGridSettings.liveCellDensity;
+
+		_rSimulationSettings.onSimulationRestoredEvent.AddListener([this]() { OnSimulationRestored(); });
 	}
 
 	void GuiGridView::RenderViewContents()
@@ -19,6 +23,10 @@ namespace SolEngine::GUI::View
 
 		RenderGridDimensionsInputInt3();
 		RenderResetGridSizeButton();
+
+		RenderLiveCellDensitySlider();
+		ImGui::SameLine();
+		RenderResetLiveCellDensityButton();
 	}
 
 	void GuiGridView::InitGuiGridDimensions()
@@ -88,6 +96,64 @@ namespace SolEngine::GUI::View
 		ImGui::EndTooltip();
 	}
 
+	void GuiGridView::RenderLiveCellDensitySlider()
+	{
+		ImGui::BeginDisabled(_rSimulationSettings.IsSimulationPlaying());
+		ImGui::SliderFloat(LABEL_GRID_LIVE_CELL_DENSITY, 
+						   &_guiLiveCellDensity, 
+						   MIN_LIVE_CELL_DENSITY, 
+						   MAX_LIVE_CELL_DENSITY, 
+						   "%.2f");
+		ImGui::EndDisabled();
+
+		// Update values after user is finished
+		if (ImGui::IsItemDeactivatedAfterEdit())
+		{
+			OnLiveCellDensityChanged();
+		}
+
+		// Tooltip - Live Cell Density
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		ImGui::BeginTooltip();
+		{
+			ImGui::Text(TOOLTIP_GRID_LIVE_CELL_DENSITY, 
+						MIN_LIVE_CELL_DENSITY,					// Min Value
+						MAX_LIVE_CELL_DENSITY,					// Max Value
+						_defaultGridSettings.liveCellDensity);	// Default Value
+		}
+		ImGui::EndTooltip();
+	}
+
+	void GuiGridView::RenderResetLiveCellDensityButton()
+	{
+		ImGui::BeginDisabled(_rSimulationSettings.IsSimulationPlaying());
+		{
+			ImGui::PushID(RESET_LIVE_CELL_DENSITY_BUTTON_ID);	// Since there are multiple buttons with a "Reset" label, we have to define a unique ID here
+			if (ImGui::Button(LABEL_GRID_LIVE_CELL_DENSITY_RESET))
+			{
+				OnLiveCellDensityReset();
+			}
+			ImGui::PopID();
+		}
+		ImGui::EndDisabled();
+
+		// Tooltip - Reset Live Cell Density
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		ImGui::BeginTooltip();
+		{
+			ImGui::Text(TOOLTIP_GRID_LIVE_CELL_DENSITY_RESET);
+		}
+		ImGui::EndTooltip();
+	}
+
 	void GuiGridView::OnGridSizeChanged()
 	{
 		int& rGuiGridDimensionsX = _guiGridDimensions[0];
@@ -127,4 +193,36 @@ namespace SolEngine::GUI::View
 		// Update GUI side...
 		InitGuiGridDimensions();
 	}
+
+	void GuiGridView::OnLiveCellDensityChanged()
+	{
+		_guiLiveCellDensity = Clamp(_guiLiveCellDensity, 
+									MIN_LIVE_CELL_DENSITY, 
+									MAX_LIVE_CELL_DENSITY);
+
+		_rGridSettings.liveCellDensity = _guiLiveCellDensity;
+
+		// Re-seed the cells with the new density
+		_rSimulationSettings.ResetGeneration();
+		_rSimulationSettings.isSimulationResetRequested = true;
+	}
+
+	void GuiGridView::OnLiveCellDensityReset()
+	{
+		_rGridSettings.ResetLiveCellDensity();
+
+		// Re-seed the cells with the new density
+		_rSimulationSettings.ResetGeneration();
+		_rSimulationSettings.isSimulationResetRequested = true;
+
+		// Update GUI side...
+		_guiLiveCellDensity = _rGridSettings.liveCellDensity;
+	}
+
+	void GuiGridView::OnSimulationRestored()
+	{
+		// A checkpoint or recording may have brought its own grid, update GUI side...
+		InitGuiGridDimensions();
+		_guiLiveCellDensity = _rGridSettings.liveCellDensity;
+	}
 }
\ No newline at end of file
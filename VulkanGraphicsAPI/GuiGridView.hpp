@@ -20,19 +20,29 @@ namespace SolEngine::GUI::View
 		void RenderViewContents();
 
 	private:
-		static constexpr const char* RESET_GRID_DIMENSIONS_BUTTON_ID {"Label##ResetGridDimensions"};
+		static constexpr float MIN_LIVE_CELL_DENSITY{ 0.f };
+		static constexpr float MAX_LIVE_CELL_DENSITY{ 1.f };
+
+		static constexpr const char* RESET_GRID_DIMENSIONS_BUTTON_ID  {"Label##ResetGridDimensions"};
+		static constexpr const char* RESET_LIVE_CELL_DENSITY_BUTTON_ID{"Label##ResetLiveCellDensity"};
 
 		void InitGuiGridDimensions();
 		void RenderGridDimensionsInputInt3();
 		void RenderResetGridSizeButton();
+		void RenderLiveCellDensitySlider();
+		void RenderResetLiveCellDensityButton();
 
 		void OnGridSizeChanged();
 		void OnGridSizeReset();
+		void OnLiveCellDensityChanged();
+		void OnLiveCellDensityReset();
+		void OnSimulationRestored();
 
 		const GridSettings  _defaultGridSettings{};
 		GridSettings&		_rGridSettings;
 		SimulationSettings& _rSimulationSettings;
 
-		int _guiGridDimensions[3]{ 0 };
+		int   _guiGridDimensions[3]{ 0 };
+		float _guiLiveCellDensity  { 0.f };
 	};
 }
@@ -0,0 +1,164 @@
+#include "GuiRecordingView.hpp"
+
+namespace SolEngine::GUI::View
+{
+	GuiRecordingView::GuiRecordingView(RecordingSettings& rRecordingSettings, 
+									   SimulationSettings& rSimulationSettings)
+		: _rRecordingSettings(rRecordingSettings),
+		  _rSimulationSettings(rSimulationSettings)
+	{
+		_guiKeyframeInterval = (int)_rRecordingSettings.keyframeInterval;
+	}
+
+	void GuiRecordingView::RenderViewContents()
+	{
+		if (!ImGui::CollapsingHeader(HEADER_RECORDING))	// This header should be collapsed by default
+		{
+			return;
+		}
+
+		// Recording Controls
+		RenderRecordButton();
+		ImGui::SameLine();
+		RenderKeyframeIntervalInput();
+
+		// Playback Controls
+		RenderPlaybackButton();
+		ImGui::SameLine();
+		RenderPlaybackGenerationSlider();
+	}
+
+	void GuiRecordingView::RenderRecordButton()
+	{
+		// Can't record whilst playing back a recording
+		ImGui::BeginDisabled(_rRecordingSettings.isPlaybackEnabled);
+		{
+			if (ImGui::Button(_rRecordingSettings.isRecording ? LABEL_RECORDING_STOP : LABEL_RECORDING_START))
+			{
+				_rRecordingSettings.isRecordingToggleRequested = true;
+			}
+		}
+		ImGui::EndDisabled();
+
+		// Tooltip - Record
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		ImGui::BeginTooltip();
+		{
+			ImGui::Text(TOOLTIP_RECORDING_RECORD);
+		}
+		ImGui::EndTooltip();
+	}
+
+	void GuiRecordingView::RenderKeyframeIntervalInput()
+	{
+		// Interval is fixed for the length of a recording
+		ImGui::BeginDisabled(_rRecordingSettings.isRecording);
+		{
+			ImGui::InputInt(LABEL_RECORDING_KEYFRAME_INTERVAL,
+							&_guiKeyframeInterval,
+							KEYFRAME_INTERVAL_INPUT_STEP,
+							KEYFRAME_INTERVAL_INPUT_FAST_STEP);
+		}
+		ImGui::EndDisabled();
+
+		// Update values after user is finished
+		if (ImGui::IsItemDeactivatedAfterEdit())
+		{
+			OnKeyframeIntervalChanged();
+		}
+
+		// Tooltip - Keyframe Interval
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		ImGui::BeginTooltip();
+		{
+			ImGui::Text(TOOLTIP_RECORDING_KEYFRAME_INTERVAL,
+						MIN_KEYFRAME_INTERVAL,
+						MAX_KEYFRAME_INTERVAL,
+						_defaultRecordingSettings.keyframeInterval);
+		}
+		ImGui::EndTooltip();
+	}
+
+	void GuiRecordingView::RenderPlaybackButton()
+	{
+		// Playback takes over the grid, so the simulation has to be paused and nothing being recorded
+		ImGui::BeginDisabled(_rSimulationSettings.IsSimulationPlaying() || _rRecordingSettings.isRecording);
+		{
+			if (ImGui::Button(_rRecordingSettings.isPlaybackEnabled ? LABEL_RECORDING_PLAYBACK_CLOSE : LABEL_RECORDING_PLAYBACK_OPEN))
+			{
+				_rRecordingSettings.isPlaybackToggleRequested = true;
+			}
+		}
+		ImGui::EndDisabled();
+
+		// Tooltip - Playback
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		ImGui::BeginTooltip();
+		{
+			ImGui::Text(TOOLTIP_RECORDING_PLAYBACK);
+		}
+		ImGui::EndTooltip();
+	}
+
+	void GuiRecordingView::RenderPlaybackGenerationSlider()
+	{
+		ImGui::BeginDisabled(!_rRecordingSettings.isPlaybackEnabled);
+		{
+			// Seek whilst scrubbing rather than after, so the grid follows the slider
+			if (ImGui::SliderScalar(LABEL_RECORDING_PLAYBACK_GENERATION,
+									ImGuiDataType_U64,
+									&_rRecordingSettings.playbackGeneration,
+									&_rRecordingSettings.firstRecordedGeneration,
+									&_rRecordingSettings.lastRecordedGeneration))
+			{
+				OnPlaybackGenerationChanged();
+			}
+		}
+		ImGui::EndDisabled();
+
+		// Tooltip - Playback Generation
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		ImGui::BeginTooltip();
+		{
+			ImGui::Text(TOOLTIP_RECORDING_PLAYBACK_GENERATION,
+						_rRecordingSettings.firstRecordedGeneration,
+						_rRecordingSettings.lastRecordedGeneration);
+		}
+		ImGui::EndTooltip();
+	}
+
+	void GuiRecordingView::OnKeyframeIntervalChanged()
+	{
+		_guiKeyframeInterval = Clamp(_guiKeyframeInterval, 
+									 MIN_KEYFRAME_INTERVAL, 
+									 MAX_KEYFRAME_INTERVAL);
+
+		_rRecordingSettings.keyframeInterval = (uint32_t)_guiKeyframeInterval;
+	}
+
+	void GuiRecordingView::OnPlaybackGenerationChanged()
+	{
+		// Ctrl+Click lets the slider be typed into, which skips its own limits
+		_rRecordingSettings.playbackGeneration = std::clamp(_rRecordingSettings.playbackGeneration, 
+															_rRecordingSettings.firstRecordedGeneration, 
+															_rRecordingSettings.lastRecordedGeneration);
+
+		_rRecordingSettings.isPlaybackSeekRequested = true;
+	}
+}
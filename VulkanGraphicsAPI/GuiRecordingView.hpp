@@ -0,0 +1,42 @@
+#pragma once
+#include "imgui.h"
+#include "RecordingSettings.hpp"
+#include "SimulationSettings.hpp"
+#include "GuiStrings.hpp"
+#include "Helpers.hpp"
+
+using namespace Utility;
+using namespace SolEngine::GUI;
+using namespace SolEngine::Settings;
+
+namespace SolEngine::GUI::View
+{
+	class GuiRecordingView
+	{
+	public:
+		GuiRecordingView() = delete;
+		GuiRecordingView(RecordingSettings& rRecordingSettings, SimulationSettings& rSimulationSettings);
+
+		void RenderViewContents();
+
+	private:
+		static constexpr int MIN_KEYFRAME_INTERVAL			  { 1 };
+		static constexpr int MAX_KEYFRAME_INTERVAL			  { 1024 };
+		static constexpr int KEYFRAME_INTERVAL_INPUT_STEP	  { 1 };
+		static constexpr int KEYFRAME_INTERVAL_INPUT_FAST_STEP{ 16 };
+
+		void RenderRecordButton();
+		void RenderKeyframeIntervalInput();
+		void RenderPlaybackButton();
+		void RenderPlaybackGenerationSlider();
+
+		void OnKeyframeIntervalChanged();
+		void OnPlaybackGenerationChanged();
+
+		const RecordingSettings _defaultRecordingSettings{};
+		RecordingSettings&		_rRecordingSettings;
+		SimulationSettings&		_rSimulationSettings;
+
+		int _guiKeyframeInterval{ 0 };
+	};
+}
@@ -19,6 +19,10 @@ namespace SolEngine::GUI::View
 		RenderCullModeCombo();
 		ImGui::SameLine(RESET_CULL_MODE_BUTTON_PADDING);
 		RenderResetCullModeButton();
+		RenderFramesInFlightSlider();
+		RenderLightingCheckbox();
+		RenderMeshingAlgorithmCombo();
+		RenderIsoSurfaceCombo();
 	}
 
 	void GuiRenderSystemView::RenderPolygonModeCombo()
@@ -74,6 +78,104 @@ namespace SolEngine::GUI::View
 		ImGui::EndTooltip();
 	}
 
+	void GuiRenderSystemView::RenderFramesInFlightSlider()
+	{
+		// Picked up next frame, the Renderer waits for the GPU before resizing its ring
+		ImGui::SliderScalar(LABEL_RENDER_FRAMES_IN_FLIGHT,
+							ImGuiDataType_U32,
+							&_rRenderSettings.framesInFlight,
+							&MIN_FRAMES_IN_FLIGHT,
+							&MAX_FRAMES_IN_FLIGHT);
+
+		// Tooltip - Frames In Flight
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		ImGui::BeginTooltip();
+		{
+			ImGui::Text(TOOLTIP_RENDER_FRAMES_IN_FLIGHT,
+						MIN_FRAMES_IN_FLIGHT,
+						MAX_FRAMES_IN_FLIGHT,
+						_defaultRenderSettings.framesInFlight);
+		}
+		ImGui::EndTooltip();
+	}
+
+	void GuiRenderSystemView::RenderLightingCheckbox()
+	{
+		// Picked up next frame, the Lit variants are pre-built alongside the rest
+		ImGui::Checkbox(LABEL_RENDER_LIGHTING, 
+						&_rRenderSettings.isLightingEnabled);
+
+		// Tooltip - Lighting
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		ImGui::BeginTooltip();
+		{
+			ImGui::Text(TOOLTIP_RENDER_LIGHTING);
+		}
+		ImGui::EndTooltip();
+	}
+
+	void GuiRenderSystemView::RenderMeshingAlgorithmCombo()
+	{
+		int selectedAlgorithm = (int)_rRenderSettings.meshingAlgorithm;
+
+		// Picked up next frame, the mesh is rebuilt from the current cells
+		if (ImGui::Combo(LABEL_RENDER_MESHING_ALGORITHM,
+						 &selectedAlgorithm, 
+						 _meshingAlgorithms, 
+						 MESHING_ALGORITHM_COUNT))
+		{
+			_rRenderSettings.meshingAlgorithm = (MeshingAlgorithm)selectedAlgorithm;
+		}
+
+		// Tooltip - Meshing Algorithm
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		ImGui::BeginTooltip();
+		{
+			ImGui::Text(TOOLTIP_RENDER_MESHING_ALGORITHM,
+						_meshingAlgorithms[(size_t)_defaultRenderSettings.meshingAlgorithm]);
+		}
+		ImGui::EndTooltip();
+	}
+
+	void GuiRenderSystemView::RenderIsoSurfaceCombo()
+	{
+		int selectedSurface = (int)_rRenderSettings.isoSurfaceType;
+
+		// Picked up next frame, the mesh is rebuilt from the current cells
+		if (ImGui::Combo(LABEL_RENDER_ISO_SURFACE,
+						 &selectedSurface, 
+						 _isoSurfaces, 
+						 ISO_SURFACE_COUNT))
+		{
+			_rRenderSettings.isoSurfaceType = (IsoSurfaceType)selectedSurface;
+		}
+
+		// Tooltip - Iso Surface
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		ImGui::BeginTooltip();
+		{
+			ImGui::Text(TOOLTIP_RENDER_ISO_SURFACE,
+						_isoSurfaces[(size_t)_defaultRenderSettings.isoSurfaceType]);
+		}
+		ImGui::EndTooltip();
+	}
+
 	void GuiRenderSystemView::RenderResetPolygonModeButton()
 	{
 		ImGui::PushID(RESET_POLYGON_MODE_BUTTON_ID);	// Since there are multiple buttons with a "Reset" label, we have to define a unique ID here
@@ -96,14 +198,13 @@ namespace SolEngine::GUI::View
 
 	void GuiRenderSystemView::OnPolygonModeChanged(const int mode)
 	{
+		// Picked up next frame, every variant is pre-built so there's nothing to rebuild
 		_rRenderSettings.polygonMode = (VkPolygonMode)mode;
-		_rRenderSettings.isRendererOutOfDate = true;
 	}
 
 	void GuiRenderSystemView::OnCullModeChanged(const int mode)
 	{
 		_rRenderSettings.cullMode = (VkCullModeFlagBits)mode;
-		_rRenderSettings.isRendererOutOfDate = true;
 	}
 
 	void GuiRenderSystemView::OnPolygonModeReset()
@@ -22,9 +22,18 @@ namespace SolEngine::GUI::View
 
 		static constexpr size_t	POLYGON_MODE_COUNT{ 3U };
 		static constexpr size_t	CULL_MODE_COUNT	  { 4U };
+		static constexpr size_t	ISO_SURFACE_COUNT { (size_t)IsoSurfaceType::COUNT };
+		static constexpr size_t	MESHING_ALGORITHM_COUNT{ (size_t)MeshingAlgorithm::COUNT };
+
+		static constexpr uint32_t MIN_FRAMES_IN_FLIGHT{ 1U };
+		static constexpr uint32_t MAX_FRAMES_IN_FLIGHT{ 4U };	// Matches SolSwapchain::MAX_FRAMES_IN_FLIGHT
 
 		void RenderPolygonModeCombo();
 		void RenderCullModeCombo();
+		void RenderFramesInFlightSlider();
+		void RenderLightingCheckbox();
+		void RenderMeshingAlgorithmCombo();
+		void RenderIsoSurfaceCombo();
 
 		void RenderResetPolygonModeButton();
 		void RenderResetCullModeButton();
@@ -40,5 +49,7 @@ namespace SolEngine::GUI::View
 
 		const char* _polygonModes[POLYGON_MODE_COUNT]{ "Fill", "Wireframe", "Point" };
 		const char* _cullModes[CULL_MODE_COUNT]		 { "None", "Front", "Back", "Front and Back" };
+		const char* _isoSurfaces[ISO_SURFACE_COUNT]	 { "Midpoint", "Neighbour Density" };
+		const char* _meshingAlgorithms[MESHING_ALGORITHM_COUNT]{ "Marching Cubes", "Greedy Voxels", "Marching Cubes (GPU)", "Instanced Cubes" };
 	};
 }
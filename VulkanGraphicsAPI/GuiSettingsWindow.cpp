@@ -8,7 +8,8 @@ namespace SolEngine::GUI
 										 GameOfLifeSettings& rGameOfLifeSettings, 
 										 SimulationSettings& rSimulationSettings, 
 										 GridSettings& rGridSettings,
-										 RenderSettings& rRenderSettings)
+										 RenderSettings& rRenderSettings,
+										 RecordingSettings& rRecordingSettings)
 		: GuiWindowBase(windowTitle,
 					 isActive,
 					 windowFlags),
@@ -16,7 +17,9 @@ namespace SolEngine::GUI
 		  _simulationView(rSimulationSettings),
 		  _gridView(rGridSettings, 
 					rSimulationSettings),
-		  _renderSystemView(rRenderSettings)
+		  _renderSystemView(rRenderSettings),
+		  _recordingView(rRecordingSettings,
+						 rSimulationSettings)
 	{}
 
 	void GuiSettingsWindow::Render()
@@ -32,6 +35,8 @@ namespace SolEngine::GUI
 		_gridView.RenderViewContents();
 		ImGui::Separator();
 		_renderSystemView.RenderViewContents();
+		ImGui::Separator();
+		_recordingView.RenderViewContents();
 
 		ImGui::End();
 	}
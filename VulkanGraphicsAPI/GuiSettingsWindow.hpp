@@ -4,6 +4,7 @@
 #include "GuiGameOfLifeView.hpp"
 #include "GuiGridView.hpp"
 #include "GuiRenderSystemView.hpp"
+#include "GuiRecordingView.hpp"
 
 using namespace SolEngine::GUI::View;
 using namespace SolEngine::Interface;
@@ -16,7 +17,7 @@ namespace SolEngine::GUI
 		GuiSettingsWindow() = delete;
 		GuiSettingsWindow(const char* windowTitle, const bool isActive, const ImGuiWindowFlags windowFlags,
 						  GameOfLifeSettings& rGameOfLifeSettings, SimulationSettings& rSimulationSettings, 
-						  GridSettings& rGridSettings, RenderSettings& rRenderSettings);
+						  GridSettings& rGridSettings, RenderSettings& rRenderSettings, RecordingSettings& rRecordingSettings);
 
 		// Inherited via IGuiWindow
 		virtual void Render() override;
@@ -26,5 +27,6 @@ namespace SolEngine::GUI
 		GuiGameOfLifeView	_gameOfLifeView;
 		GuiGridView			_gridView;
 		GuiRenderSystemView _renderSystemView;
+		GuiRecordingView	_recordingView;
 	};
 }
@@ -7,6 +7,8 @@ namespace SolEngine::GUI::View
 	{
 		_simulationSpeed = _rSimulationSettings.speed;
 		SetSimulationState(_rSimulationSettings.state);
+
+		_rSimulationSettings.onSimulationRestoredEvent.AddListener([this]() { OnSimulationRestored(); });
 	}
 
 	void GuiSimulationView::RenderViewContents()
@@ -29,9 +31,17 @@ namespace SolEngine::GUI::View
 		ImGui::SameLine();
 		RenderSimulationResetSpeedButton();
 
+		RenderSimulationFastForwardCheckbox();
+		RenderSimulationBackendCombo();
+
 		RenderSimulationPauseButton(); 
 		ImGui::SameLine();
 		RenderSimulationResetButton();
+
+		// Checkpoint Controls
+		RenderSimulationSaveButton();
+		ImGui::SameLine();
+		RenderSimulationLoadButton();
 	}
 
 	void GuiSimulationView::SetSimulationState(const SimulationState state)
@@ -190,6 +200,51 @@ namespace SolEngine::GUI::View
 		ImGui::EndTooltip();
 	}
 
+	void GuiSimulationView::RenderSimulationFastForwardCheckbox()
+	{
+		ImGui::Checkbox(LABEL_SIMULATION_FAST_FORWARD, 
+						&_rSimulationSettings.isFastForwardEnabled);
+
+		// Tooltip - Fast Forward
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		ImGui::BeginTooltip();
+		{
+			ImGui::Text(TOOLTIP_SIMULATION_FAST_FORWARD);
+		}
+		ImGui::EndTooltip();
+	}
+
+	void GuiSimulationView::RenderSimulationBackendCombo()
+	{
+		int selectedBackend = (int)_rSimulationSettings.backend;
+
+		// Picked up by the next batch of generations
+		if (ImGui::Combo(LABEL_SIMULATION_BACKEND,
+						 &selectedBackend, 
+						 _simulationBackends, 
+						 SIMULATION_BACKEND_COUNT))
+		{
+			_rSimulationSettings.backend = (SimulationBackend)selectedBackend;
+		}
+
+		// Tooltip - Simulation Backend
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		ImGui::BeginTooltip();
+		{
+			ImGui::Text(TOOLTIP_SIMULATION_BACKEND,
+						_simulationBackends[(size_t)_defaultSimulationSettings.backend]);
+		}
+		ImGui::EndTooltip();
+	}
+
 	void GuiSimulationView::RenderSimulationPauseButton()
 	{
 		if (ImGui::Button(_toggleStateButtonText.c_str()))
@@ -234,6 +289,51 @@ namespace SolEngine::GUI::View
 		ImGui::EndTooltip();
 	}
 
+	void GuiSimulationView::RenderSimulationSaveButton()
+	{
+		if (ImGui::Button(LABEL_SIMULATION_SAVE))
+		{
+			_rSimulationSettings.isCheckpointSaveRequested = true;
+		}
+
+		// Tooltip - Save Checkpoint
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		ImGui::BeginTooltip();
+		{
+			ImGui::Text(TOOLTIP_SIMULATION_SAVE);
+		}
+		ImGui::EndTooltip();
+	}
+
+	void GuiSimulationView::RenderSimulationLoadButton()
+	{
+		// Loading swaps out the whole grid, so don't allow it mid-simulation
+		ImGui::BeginDisabled(_rSimulationSettings.IsSimulationPlaying());
+		{
+			if (ImGui::Button(LABEL_SIMULATION_LOAD))
+			{
+				_rSimulationSettings.isCheckpointLoadRequested = true;
+			}
+		}
+		ImGui::EndDisabled();
+
+		// Tooltip - Load Checkpoint
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		ImGui::BeginTooltip();
+		{
+			ImGui::Text(TOOLTIP_SIMULATION_LOAD);
+		}
+		ImGui::EndTooltip();
+	}
+
 	void GuiSimulationView::OnSimulationSeedChanged()
 	{
 		_simulationSeed	= Clamp(_simulationSeed, 
@@ -307,4 +407,10 @@ namespace SolEngine::GUI::View
 		}
 		}
 	}
+
+	void GuiSimulationView::OnSimulationRestored()
+	{
+		// Pick up the restored values on GUI side
+		_simulationSeed = _rSimulationSettings.seed;
+	}
 }
\ No newline at end of file
@@ -33,13 +33,19 @@ namespace SolEngine::GUI::View
 		static constexpr const char* RESET_SEED_BUTTON_ID {"Label##ResetSimulationSeed"};
 		static constexpr const char* RESET_SPEED_BUTTON_ID{"Label##ResetSimulationSpeed"};
 
+		static constexpr size_t SIMULATION_BACKEND_COUNT{ (size_t)SimulationBackend::COUNT };
+
 		void RenderSimulationGenerationText();
 		void RenderSimulationSeedInput();
 		void RenderSimulationResetSeedButton();
 		void RenderSimulationSimulationSpeedInput();
 		void RenderSimulationResetSpeedButton();
+		void RenderSimulationFastForwardCheckbox();
+		void RenderSimulationBackendCombo();
 		void RenderSimulationPauseButton();
 		void RenderSimulationResetButton();
+		void RenderSimulationSaveButton();
+		void RenderSimulationLoadButton();
 
 		void OnSimulationSeedChanged();
 		void OnSimulationSpeedChanged();
@@ -49,6 +55,7 @@ namespace SolEngine::GUI::View
 		void OnSimulationReset();
 
 		void OnSimulationStateToggled();
+		void OnSimulationRestored();
 
 		const SimulationSettings _defaultSimulationSettings{};
 		SimulationSettings&		 _rSimulationSettings;
@@ -56,5 +63,7 @@ namespace SolEngine::GUI::View
 		float		_simulationSpeed	  { 0.f };
 		int			_simulationSeed		  { 0 };
 		std::string _toggleStateButtonText{};
+
+		const char* _simulationBackends[SIMULATION_BACKEND_COUNT]{ "CPU", "GPU Compute" };
 	};
 }
\ No newline at end of file
@@ -9,15 +9,20 @@ namespace SolEngine::GUI
 	static constexpr const char* HEADER_GAME_OF_LIFE { "Game of Life " };	// Added Space for quick padding
 	static constexpr const char* HEADER_GRID		 { "Grid " };			// Added Space for quick padding
 	static constexpr const char* HEADER_RENDER_SYSTEM{ "Render System " };	// Added Space for quick padding
+	static constexpr const char* HEADER_RECORDING	 { "Recording " };		// Added Space for quick padding
 
 	static constexpr const char* LABEL_SIMULATION_GENERATION { "Generation: %zu" };
 	static constexpr const char* LABEL_SIMULATION_SEED		 { "Seed" };
 	static constexpr const char* LABEL_SIMULATION_SEED_RESET { "Reset" };
 	static constexpr const char* LABEL_SIMULATION_SPEED		 { "Speed" };
 	static constexpr const char* LABEL_SIMULATION_SPEED_RESET{ "Reset" };
+	static constexpr const char* LABEL_SIMULATION_FAST_FORWARD{ "Fast Forward" };
+	static constexpr const char* LABEL_SIMULATION_BACKEND	 { "Backend" };
 	static constexpr const char* LABEL_SIMULATION_RESET		 { "Reset" };
 	static constexpr const char* LABEL_SIMULATION_STATE_PLAY { "Play" };
 	static constexpr const char* LABEL_SIMULATION_STATE_PAUSE{ "Pause" };
+	static constexpr const char* LABEL_SIMULATION_SAVE		 { "Save" };
+	static constexpr const char* LABEL_SIMULATION_LOAD		 { "Load" };
 
 	static constexpr const char* LABEL_GAME_OF_LIFE_MIN_LIVE_NEIGHBOURS  { "Underpopulation Value" };
 	static constexpr const char* LABEL_GAME_OF_LIFE_MAX_LIVE_NEIGHBOURS  { "Overpopulation Value" };
@@ -26,17 +31,38 @@ namespace SolEngine::GUI
 
 	static constexpr const char* LABEL_GRID_DIMENSIONS		 { "Grid Dimensions" };
 	static constexpr const char* LABEL_GRID_DIMENSIONS_RESET { "Reset" };
+	static constexpr const char* LABEL_GRID_LIVE_CELL_DENSITY		{ "Live Cell Density" };
+	static constexpr const char* LABEL_GRID_LIVE_CELL_DENSITY_RESET { "Reset" };
 
 	static constexpr const char* LABEL_RENDER_POLYGON_MODE_RESET { "Reset" };
 	static constexpr const char* LABEL_RENDER_CULL_MODE_RESET	 { "Reset" };
+	static constexpr const char* LABEL_RENDER_FRAMES_IN_FLIGHT	 { "Frames In Flight" };
+	static constexpr const char* LABEL_RENDER_ISO_SURFACE		 { "Iso Surface" };
+	static constexpr const char* LABEL_RENDER_MESHING_ALGORITHM	 { "Meshing" };
+	static constexpr const char* LABEL_RENDER_LIGHTING			 { "Lighting" };
+
+	static constexpr const char* LABEL_RECORDING_START				 { "Record" };
+	static constexpr const char* LABEL_RECORDING_STOP				 { "Stop" };
+	static constexpr const char* LABEL_RECORDING_KEYFRAME_INTERVAL	 { "Keyframe Interval" };
+	static constexpr const char* LABEL_RECORDING_PLAYBACK_OPEN		 { "Playback" };
+	static constexpr const char* LABEL_RECORDING_PLAYBACK_CLOSE		 { "Exit" };
+	static constexpr const char* LABEL_RECORDING_PLAYBACK_GENERATION { "Generation" };
 
 	static constexpr const char* TOOLTIP_SIMULATION_GENERATION { "Current Simulation Generation." };
 	static constexpr const char* TOOLTIP_SIMULATION_SEED	   { "Seed used for Generating Random Cell States.\n(Min: %i, Max: %i, Default: %i)" };
 	static constexpr const char* TOOLTIP_SIMULATION_SEED_RESET { "Resets the Simulation Seed to Default.\nSimulation MUST be paused to reset." };
 	static constexpr const char* TOOLTIP_SIMULATION_SPEED	   { "Adjusts Delay between Generations (Seconds).\n(Min: %.2f, Max: %.2f, Default: %.2f)" };
 	static constexpr const char* TOOLTIP_SIMULATION_SPEED_RESET{ "Resets the Simulation Speed to Default." };
+	static constexpr const char* TOOLTIP_SIMULATION_FAST_FORWARD{ "Runs as many Generations as possible each Frame, ignoring Speed.\nOnly the last Generation of each Frame is Rendered." };
+	static constexpr const char* TOOLTIP_SIMULATION_BACKEND{ "Specifies what steps the Generations.\n\
+CPU: Stepped on the CPU.\n\
+GPU Compute: Stepped by a Compute Shader, the Cells are only read back once per Frame.\n\
+Needs Shaders/GameOfLife.comp.spv from compile_shaders.bat, and steps on the CPU whilst Recording.\n\
+Default: %s"};
 	static constexpr const char* TOOLTIP_SIMULATION_PAUSE	   { "Pauses and Resumes the Simulation." };
 	static constexpr const char* TOOLTIP_SIMULATION_RESET	   { "Reset Simulation.\nSimulation MUST be paused to reset." };
+	static constexpr const char* TOOLTIP_SIMULATION_SAVE	   { "Saves the Grid, Rules and Generation to a Checkpoint.\nSaving runs in the Background." };
+	static constexpr const char* TOOLTIP_SIMULATION_LOAD	   { "Restores the last saved Checkpoint.\nSimulation MUST be paused to load." };
 
 	static constexpr const char* TOOLTIP_GAME_OF_LIFE_RESET					   { "Resets the Game of Life Ruleset to Default Settings." };
 	static constexpr const char* TOOLTIP_GAME_OF_LIFE_NEIGHBOURHOOD_TYPE	   { "Defines Cell Neighbours.\n(Moore: Include Diagonals, Von Neumann: Exclude Diagonals)." };
@@ -46,6 +72,13 @@ namespace SolEngine::GUI
 
 	static constexpr const char* TOOLTIP_GRID_DIMENSIONS	  { "Sets the Grid Dimensions.\nSimulation MUST be paused to edit.\n(Min: %u, Max: %u, Default: x: %u, y: %u, z: %u)." };
 	static constexpr const char* TOOLTIP_GRID_DIMENSIONS_RESET{ "Reset Grid Dimensions.\nSimulation MUST be paused to reset." };
+	static constexpr const char* TOOLTIP_GRID_LIVE_CELL_DENSITY		 { "Chance of each Cell starting ALIVE when the Grid is Seeded.\nSimulation MUST be paused to edit.\n(Min: %.2f, Max: %.2f, Default: %.2f)." };
+	static constexpr const char* TOOLTIP_GRID_LIVE_CELL_DENSITY_RESET{ "Reset Live Cell Density.\nSimulation MUST be paused to reset." };
+
+	static constexpr const char* TOOLTIP_RECORDING_RECORD			   { "Starts and Stops Recording every Generation to disk.\nResetting or Resizing the Grid stops the Recording." };
+	static constexpr const char* TOOLTIP_RECORDING_KEYFRAME_INTERVAL   { "Generations between full Snapshots, all others only store changed Cells.\nLower values Seek faster but use more disk space.\n(Min: %i, Max: %i, Default: %u)." };
+	static constexpr const char* TOOLTIP_RECORDING_PLAYBACK			   { "Opens the last Recording for Playback.\nSimulation MUST be paused and not Recording.\nExiting continues the Simulation from the shown Generation." };
+	static constexpr const char* TOOLTIP_RECORDING_PLAYBACK_GENERATION { "Recorded Generation to show.\n(Min: %zu, Max: %zu)." };
 
 	static constexpr const char* TOOLTIP_RENDER_POLYGON_MODE{ "Specifies the method of rasterization for polygons.\n\
 Fill: Polygons are rendered using the polygon rasterization rules.\n\
@@ -57,5 +90,17 @@ None: No triangles are discarded.\n\
 Front: Front-facing triangles are discarded.\n\
 Back: Back-facing triangles are discarded.\n\
 Front and Back: All triangles are discarded.\n\
+Default: %s"};
+	static constexpr const char* TOOLTIP_RENDER_FRAMES_IN_FLIGHT{ "Frames the CPU may prepare whilst the GPU is still rendering.\nMore Frames raise throughput at the cost of input latency.\n(Min: %u, Max: %u, Default: %u)." };
+	static constexpr const char* TOOLTIP_RENDER_ISO_SURFACE{ "Specifies what the Marching Cubes surface is built from.\n\
+Midpoint: Cell States, Vertices sit halfway along each edge (Blocky).\n\
+Neighbour Density: Live Neighbour Density, Vertices are interpolated along each edge (Smooth).\n\
+Default: %s"};
+	static constexpr const char* TOOLTIP_RENDER_LIGHTING{ "Shades the mesh by how much each triangle faces the light, making depth easier to read.\nNeeds Shaders/LitShader.vert.spv from compile_shaders.bat, otherwise draws unlit." };
+	static constexpr const char* TOOLTIP_RENDER_MESHING_ALGORITHM{ "Specifies how the Cells are turned into triangles.\n\
+Marching Cubes: A surface between Live and Dead Cells, shaped by the Iso Surface.\n\
+Greedy Voxels: Live Cells as blocks, touching faces are merged into as few triangles as possible.\n\
+Marching Cubes (GPU): The Midpoint surface meshed on the GPU, no vertices are uploaded.\nNeeds Shaders/MarchingCubes.comp.spv from compile_shaders.bat, otherwise falls back to Marching Cubes.\n\
+Instanced Cubes: A cube drawn per Live Cell, only the Live Cells are uploaded.\nNeeds Shaders/CubeInstanceShader.vert.spv from compile_shaders.bat, otherwise falls back to Marching Cubes.\n\
 Default: %s"};
 }
\ No newline at end of file
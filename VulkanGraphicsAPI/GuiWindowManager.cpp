@@ -73,7 +73,7 @@ namespace SolEngine::GUI
             .Device          = rSolDevice.GetDevice(),
             .QueueFamily     = rSolDevice.QueryPhysicalDeviceQueueFamilies().graphicsFamily,
             .Queue           = rSolDevice.GetGraphicsQueue(),
-            .PipelineCache   = VK_NULL_HANDLE,
+            .PipelineCache   = rSolDevice.GetPipelineCache(),
             .DescriptorPool  = descriptorPool,
             .Subpass         = 0,
             .MinImageCount   = SolSwapchain::MAX_FRAMES_IN_FLIGHT,
@@ -2,7 +2,6 @@
 #include <glm/glm.hpp>
 #include <time.h>
 
-#include "Axis.hpp"
 #include "Constants.hpp"
 #include "Typedefs.hpp"
 #include "RandomNumberGenerator.hpp"
@@ -74,137 +73,18 @@ namespace Utility
     }
 
     /// <summary>
-    /// Generates Vertices along an axis
+    /// Seeds the cell states, each cell being alive with a probability of liveCellDensity.
     /// </summary>
     /// <returns>Bytes used.</returns>
-    template<Axis>
-    static size_t GenerateVertices(int* pOutPositions,
-                                   const int minValue, 
-                                   const int maxValue) = delete;
-
-    template<>
-    static size_t GenerateVertices<Axis::X>(int* pOutXPositions,
-                                            const int minValue, 
-                                            const int maxValue)
-    {
-        size_t   bytesInUse = 0;
-        uint32_t rowIndex   = 0;
-
-        for (int xPos = minValue; xPos < maxValue; ++xPos)
-        {
-            const int      adjXPos  = xPos + 1;
-            const uint32_t rowWidth = rowIndex * CUBE_VERTEX_COUNT;
-
-            pOutXPositions[rowWidth]     = xPos;
-            pOutXPositions[rowWidth + 1] = adjXPos;
-            pOutXPositions[rowWidth + 2] = adjXPos;
-            pOutXPositions[rowWidth + 3] = xPos;
-            pOutXPositions[rowWidth + 4] = xPos;
-            pOutXPositions[rowWidth + 5] = adjXPos;
-            pOutXPositions[rowWidth + 6] = adjXPos;
-            pOutXPositions[rowWidth + 7] = xPos;
-
-            ++rowIndex;
-            bytesInUse += (INT_SIZE_BYTES * CUBE_VERTEX_COUNT);
-        }
-
-        printf_s("Generated %u X-Positions.\n", rowIndex);
-
-        return bytesInUse;
-    }
-
-    template<>
-    static size_t GenerateVertices<Axis::Y>(int* pOutYPositions,
-                                            const int minValue, 
-                                            const int maxValue)
-    {
-        size_t   bytesInUse = 0;
-        uint32_t rowIndex   = 0;
-
-        for (int yPos = minValue; yPos > maxValue; --yPos)
-        {
-            const int      adjYPos  = yPos - 1;
-            const uint32_t rowWidth = rowIndex * CUBE_VERTEX_COUNT;
-
-            pOutYPositions[rowWidth]     = yPos;
-            pOutYPositions[rowWidth + 1] = yPos;
-            pOutYPositions[rowWidth + 2] = yPos;
-            pOutYPositions[rowWidth + 3] = yPos;
-            pOutYPositions[rowWidth + 4] = adjYPos;
-            pOutYPositions[rowWidth + 5] = adjYPos;
-            pOutYPositions[rowWidth + 6] = adjYPos;
-            pOutYPositions[rowWidth + 7] = adjYPos;
-
-            ++rowIndex;
-            bytesInUse += (INT_SIZE_BYTES * CUBE_VERTEX_COUNT);
-        }
-
-        printf_s("Generated %u Y-Positions.\n", rowIndex);
-
-        return bytesInUse;
-    }
-
-    template<>
-    static size_t GenerateVertices<Axis::Z>(int* pOutZPositions,
-                                            const int minValue, 
-                                            const int maxValue)
-    {
-        size_t   bytesInUse = 0;
-        uint32_t rowIndex   = 0;
-
-        for (int zPos = minValue; zPos < maxValue; ++zPos)
-        {
-            const int      adjZPos  = zPos + 1;
-            const uint32_t rowWidth = rowIndex * CUBE_VERTEX_COUNT;
-
-            pOutZPositions[rowWidth]     = zPos;
-            pOutZPositions[rowWidth + 1] = zPos;
-            pOutZPositions[rowWidth + 2] = adjZPos;
-            pOutZPositions[rowWidth + 3] = adjZPos;
-            pOutZPositions[rowWidth + 4] = zPos;
-            pOutZPositions[rowWidth + 5] = zPos;
-            pOutZPositions[rowWidth + 6] = adjZPos;
-            pOutZPositions[rowWidth + 7] = adjZPos;
-
-            ++rowIndex;
-            bytesInUse += (INT_SIZE_BYTES * CUBE_VERTEX_COUNT);
-        }
-
-        printf_s("Generated %u Z-Positions.\n", rowIndex);
-
-        return bytesInUse;
-    }
-
     static size_t GenerateRandomStates(bool* pOutNodeStates,
-                                       const size_t count)
-    {
-        const size_t stateSizeBytes = sizeof(bool);
-        size_t       bytesInUse     = 0;
-
-        for (size_t i = 0; i < count; ++i)
-        {
-            pOutNodeStates[i] = RandomNumberGenerator::GetRandomBool();
-
-            bytesInUse += stateSizeBytes;
-        }
-
-        return bytesInUse;
-    }
-
-    static size_t DefaultLiveNeighbours(unsigned char* pOutLiveNeighbours,
-                                        const size_t count)
+                                       const size_t count,
+                                       const float liveCellDensity)
     {
-        const size_t neighbourCountSizeBytes = sizeof(NeighbourCount_t);
-        size_t       bytesInUse              = 0;
-
-        for (size_t i = 0; i < count; ++i)
-        {
-            pOutLiveNeighbours[i] = 0;
-
-            bytesInUse += neighbourCountSizeBytes;
-        }
+        RandomNumberGenerator::FillRandomBools(pOutNodeStates, 
+                                               count, 
+                                               liveCellDensity);
 
-        return bytesInUse;
+        return count * sizeof(bool);
     }
 
     /// <summary>
@@ -246,39 +126,6 @@ namespace Utility
         return (isoLevel - isoValueA) / (isoValueB - isoValueA);
     }
 
-    static std::pair<Index_t, Index_t> CornerIndicesFromEdgeIndex(const Index_t edgeIndex)
-    {
-        switch (edgeIndex)
-        {
-        case 0:
-            return { 0, 1 };
-        case 1:
-            return { 1, 2 };
-        case 2:
-            return { 2, 3 };
-        case 3:
-            return { 3, 0 };
-        case 4:
-            return { 4, 5 };
-        case 5:
-            return { 5, 6 };
-        case 6:
-            return { 6, 7 };
-        case 7:
-            return { 7, 4 };
-        case 8:
-            return { 0, 4 };
-        case 9:
-            return { 1, 5 };
-        case 10:
-            return { 2, 6 };
-        case 11:
-            return { 3, 7 };
-        default:
-            return { -1, -1 };
-        }
-    }
-
     static void DimensionsToBounds(const glm::vec3& dimensions, 
                                    glm::vec3* pOutMinBounds, 
                                    glm::vec3* pOutMaxBounds)
@@ -0,0 +1,205 @@
+#include <algorithm>
+
+#include "InstancedCubeSystem.hpp"
+
+namespace SolEngine::System
+{
+    InstancedCubeSystem::InstancedCubeSystem(SolDevice& rSolDevice,
+                                             SolRenderer& rSolRenderer,
+                                             SolGrid& rSolGrid,
+                                             DiagnosticData& rDiagnosticData)
+        : _rSolDevice(rSolDevice),
+          _rSolRenderer(rSolRenderer),
+          _rSolGrid(rSolGrid),
+          _rDiagnosticData(rDiagnosticData),
+          _instancedCubeObject(SolGameObject::CreateGameObject())
+    {
+        ResizeInstanceBuffer(MIN_INSTANCE_CAPACITY);
+        CreateCubeModel();
+    }
+
+    void InstancedCubeSystem::UpdateInstances()
+    {
+        // Start back at the beginning of the array
+        // To re-use instances.
+        _instances.clear();
+
+        // The cube sits on the grid's first cell, so it moves with the grid
+        if (_rSolGrid.GetMinBounds() != _cubeMinBounds)
+        {
+            _rSolRenderer.DeferRelease(_instancedCubeObject.GetModel());
+
+            CreateCubeModel();
+        }
+
+        const glm::uvec3 gridDimensions = _rSolGrid.GetDimensions();
+
+        // Coloured by grid position, the same as the meshes
+        _instancedCubeObject.SetColour(1.f / glm::vec3(gridDimensions));
+
+        // Same order as _3DTo1DIndex, so the cell states are read straight through
+        size_t cellIndex(0U);
+
+        for (uint32_t z(0U); z < gridDimensions.z; ++z)
+        {
+            for (uint32_t y(0U); y < gridDimensions.y; ++y)
+            {
+                for (uint32_t x(0U); x < gridDimensions.x; ++x, ++cellIndex)
+                {
+                    if (!_rSolGrid.cells.pCellStates[cellIndex])
+                    {
+                        continue;
+                    }
+
+                    _instances.emplace_back(glm::uvec3(x, y, z));
+                }
+            }
+        }
+
+        const uint32_t instanceCount = (uint32_t)_instances.size();
+
+        if (instanceCount > _instanceCapacity)
+        {
+            ResizeInstanceBuffer((std::max)(MIN_INSTANCE_CAPACITY,
+                                            (uint32_t)(instanceCount * INSTANCE_CAPACITY_GROWTH)));
+        }
+
+        // Copied at the start of the next frame, after the last frame to read the buffer has finished with it
+        _rSolRenderer.UploadToBuffer(_pInstanceBuffer->GetBuffer(),
+                                     _instances.data(),
+                                     sizeof(CellInstance) * instanceCount);
+
+        _instancedCubeObject.GetModel()->SetInstances(_pInstanceBuffer,
+                                                      instanceCount);
+
+        // Update Diagnostic Data, every instance draws the whole cube
+        const size_t instanceSizeBytes = sizeof(CellInstance);
+
+        _rDiagnosticData.vertexCount                  = (size_t)instanceCount * CUBE_VERTEX_COUNT;
+        _rDiagnosticData.triCount                     = (size_t)instanceCount * (CUBE_INDEX_COUNT / 3U);
+        _rDiagnosticData.verticesMemoryAllocatedBytes = _instanceCapacity * instanceSizeBytes;
+        _rDiagnosticData.verticesMemoryUsedBytes      = instanceCount * instanceSizeBytes;
+    }
+
+    void InstancedCubeSystem::ResetVerticesContainerSize()
+    {
+        _instances.clear();
+        _instances.shrink_to_fit();
+
+        if (_instanceCapacity <= MIN_INSTANCE_CAPACITY)
+        {
+            return;
+        }
+
+        ResizeInstanceBuffer(MIN_INSTANCE_CAPACITY);
+
+        // The new instance buffer is empty until the next update
+        _instancedCubeObject.GetModel()->SetInstances(_pInstanceBuffer,
+                                                      0U);
+    }
+
+    void InstancedCubeSystem::CreateCubeModel()
+    {
+        _cubeMinBounds = _rSolGrid.GetMinBounds();
+
+        Vertex   cubeVertices[CUBE_VERTEX_COUNT];
+        UIndex_t cubeIndices[CUBE_INDEX_COUNT];
+
+        uint32_t faceIndex(0U);
+
+        // Every axis has faces pointing both ways
+        for (uint32_t axis(0U); axis < AXIS_COUNT; ++axis)
+        {
+            for (const int faceDirection : { -1, 1 })
+            {
+                const uint32_t uAxis = (axis + 1U) % AXIS_COUNT;
+                const uint32_t vAxis = (axis + 2U) % AXIS_COUNT;
+
+                // The cube is centred on its cell, the same as VoxelMeshSystem's faces
+                glm::vec3 faceOrigin(-0.5f);
+                faceOrigin[axis] += (faceDirection > 0) ? 1.f : 0.f;
+
+                glm::vec3 uEdge(0.f);
+                glm::vec3 vEdge(0.f);
+                uEdge[uAxis] = 1.f;
+                vEdge[vAxis] = 1.f;
+
+                const glm::vec3 gridCorners[FACE_VERTEX_COUNT]
+                {
+                    faceOrigin,
+                    faceOrigin + uEdge,
+                    faceOrigin + uEdge + vEdge,
+                    faceOrigin + vEdge
+                };
+
+                // Out of the cube, which is also the face's normal
+                glm::vec3 exposedDirection(0.f);
+                exposedDirection[axis] = (float)faceDirection;
+
+                // The grid's y-axis runs downwards from its min bounds
+                const glm::vec3 modelSpaceFlip(1.f, -1.f, 1.f);
+                const glm::vec3 exposedModelDirection = exposedDirection * modelSpaceFlip;
+
+                glm::vec3 modelCorners[FACE_VERTEX_COUNT];
+
+                for (uint32_t i(0U); i < FACE_VERTEX_COUNT; ++i)
+                {
+                    modelCorners[i] = gridCorners[i] * modelSpaceFlip;
+
+                    // Colour comes from the instance
+                    cubeVertices[faceIndex * FACE_VERTEX_COUNT + i] = Vertex(glm::vec3(_cubeMinBounds) + modelCorners[i],
+                                                                             glm::vec3(1.f),
+                                                                             exposedModelDirection);
+                }
+
+                // Wound like the marching cubes mesh, with (b - a) x (c - a) pointing into the cube
+                const glm::vec3 windingDirection = glm::cross(modelCorners[1] - modelCorners[0],
+                                                              modelCorners[2] - modelCorners[0]);
+
+                static constexpr uint32_t WOUND_INDICES[FACE_INDEX_COUNT]   { 0U, 1U, 2U, 0U, 2U, 3U };
+                static constexpr uint32_t REWOUND_INDICES[FACE_INDEX_COUNT] { 0U, 2U, 1U, 0U, 3U, 2U };
+
+                const uint32_t* pIndices = (glm::dot(windingDirection, exposedModelDirection) > 0.f) ? REWOUND_INDICES
+                                                                                                      : WOUND_INDICES;
+
+                for (uint32_t i(0U); i < FACE_INDEX_COUNT; ++i)
+                {
+                    cubeIndices[faceIndex * FACE_INDEX_COUNT + i] = (UIndex_t)(faceIndex * FACE_VERTEX_COUNT + pIndices[i]);
+                }
+
+                ++faceIndex;
+            }
+        }
+
+        std::shared_ptr<SolModel> pCubeModel =
+            std::make_shared<SolModel>(_rSolDevice,
+                                       _rSolRenderer,
+                                       cubeVertices,
+                                       CUBE_VERTEX_COUNT,
+                                       cubeIndices,
+                                       CUBE_INDEX_COUNT);
+
+        // Nothing to draw until the first update
+        pCubeModel->SetInstances(_pInstanceBuffer,
+                                 0U);
+
+        _instancedCubeObject.SetModel(pCubeModel);
+    }
+
+    void InstancedCubeSystem::ResizeInstanceBuffer(const uint32_t instanceCapacity)
+    {
+        if (_pInstanceBuffer != nullptr)
+        {
+            // Frames in flight may still be drawing from it
+            _rSolRenderer.DeferRelease(_pInstanceBuffer);
+        }
+
+        _pInstanceBuffer = std::make_shared<SolBuffer>(_rSolDevice,
+                                                       sizeof(CellInstance),
+                                                       instanceCapacity,
+                                                       VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                                       VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        _instanceCapacity = instanceCapacity;
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "SolGrid.hpp"
+#include "SolGameObject.hpp"
+#include "SolRenderer.hpp"
+#include "CellInstance.hpp"
+
+namespace SolEngine::System
+{
+	/// <summary>
+	/// Draws a cube per live cell, as instances of one small indexed cube rather than a mesh of the whole grid.
+	/// Each generation only uploads the live cells' indices, 4 bytes each, so there's no meshing at all.
+	/// </summary>
+	class InstancedCubeSystem
+	{
+	public:
+		InstancedCubeSystem(SolDevice& rSolDevice, SolRenderer& rSolRenderer, SolGrid& rSolGrid, DiagnosticData& rDiagnosticData);
+
+		SolGameObject& GetGameObject() { return _instancedCubeObject; }
+
+		/// <summary>
+		/// Gathers the live cells into instances and uploads them, at the start of the next frame.
+		/// </summary>
+		void UpdateInstances();
+		void ResetVerticesContainerSize();
+
+	private:
+		static constexpr uint32_t AXIS_COUNT			  { 3U };
+		static constexpr uint32_t FACE_COUNT			  { 6U };
+		static constexpr uint32_t FACE_VERTEX_COUNT		  { 4U };
+		static constexpr uint32_t FACE_INDEX_COUNT		  { 6U };	// 2 Triangles
+		static constexpr uint32_t CUBE_VERTEX_COUNT		  { FACE_COUNT * FACE_VERTEX_COUNT };	// Faces don't share vertices, as their normals differ
+		static constexpr uint32_t CUBE_INDEX_COUNT		  { FACE_COUNT * FACE_INDEX_COUNT };
+		static constexpr uint32_t MIN_INSTANCE_CAPACITY	  { 4096U };
+		static constexpr float	  INSTANCE_CAPACITY_GROWTH{ 1.5f };	// Room to grow, so a growing population doesn't reallocate every generation
+
+		/// <summary>
+		/// A unit cube centred on the grid's first cell, in model space, wound like VoxelMeshSystem's quads.
+		/// CubeInstanceShader moves it along to each instance's cell.
+		/// </summary>
+		void CreateCubeModel();
+
+		/// <summary>
+		/// Swaps the instance buffer for one of the given capacity, the old one is released once the GPU has finished with it.
+		/// </summary>
+		void ResizeInstanceBuffer(const uint32_t instanceCapacity);
+
+		SolDevice&		_rSolDevice;
+		SolRenderer&	_rSolRenderer;
+		SolGrid&		_rSolGrid;
+		DiagnosticData& _rDiagnosticData;
+		SolGameObject	_instancedCubeObject;
+
+		std::vector<CellInstance>  _instances		  {};
+		std::shared_ptr<SolBuffer> _pInstanceBuffer	  {};	// Device Local, reused across generations
+		uint32_t				   _instanceCapacity  { 0U };
+		glm::ivec3				   _cubeMinBounds	  { 0 };	// Of the grid the cube model was made for
+	};
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+namespace SolEngine::Enumeration
+{
+	enum class IsoSurfaceType
+	{
+		UNKNOWN = -1,
+		MIDPOINT,			// Cell states as corners, vertices at edge midpoints (Blocky)
+		NEIGHBOUR_DENSITY,	// Live neighbour density as corners, vertices interpolated along edges (Smooth)
+		COUNT
+	};
+}
@@ -0,0 +1,461 @@
+#include <algorithm>
+#include <cstring>
+
+#include "MarchingCubesComputeSystem.hpp"
+
+namespace SolEngine::System
+{
+    MarchingCubesComputeSystem::MarchingCubesComputeSystem(SolDevice& rSolDevice,
+                                                           SolRenderer& rSolRenderer,
+                                                           SolShaderLibrary& rSolShaderLibrary,
+                                                           SolGrid& rSolGrid,
+                                                           DiagnosticData& rDiagnosticData)
+        : _rSolDevice(rSolDevice),
+          _rSolRenderer(rSolRenderer),
+          _rSolShaderLibrary(rSolShaderLibrary),
+          _rSolGrid(rSolGrid),
+          _rDiagnosticData(rDiagnosticData),
+          _marchingCubesObject(SolGameObject::CreateGameObject())
+    {
+        // Shaders are compiled by hand with compile_shaders.bat, so carry on with just the CPU if it hasn't been
+        if (!std::filesystem::exists(COMPUTE_SHADER_PATH))
+        {
+            DebugHelpers::DPrintf("Compute Shader missing, GPU Marching Cubes is unavailable: %s\n",
+                                  COMPUTE_SHADER_PATH);
+
+            return;
+        }
+
+        CreateBuffers();
+        CreateDescriptorSetLayout();
+        CreatePipeline();
+
+        ResizeVertexBuffer(MIN_VERTEX_CAPACITY);
+    }
+
+    MarchingCubesComputeSystem::~MarchingCubesComputeSystem()
+    {
+        Dispose();
+    }
+
+    void MarchingCubesComputeSystem::ResetVerticesContainerSize()
+    {
+        if (!IsAvailable() ||
+            _vertexCapacity == MIN_VERTEX_CAPACITY)
+        {
+            return;
+        }
+
+        ResizeVertexBuffer(MIN_VERTEX_CAPACITY);
+
+        // The new vertex buffer is empty
+        _isMarchRequested = true;
+    }
+
+    void MarchingCubesComputeSystem::RebuildPipeline()
+    {
+        // Never built, as the shader was missing at start up
+        if (_pDescriptorSetLayout == nullptr)
+        {
+            return;
+        }
+
+        DestroyPipeline();
+        CreatePipeline();
+
+        // March again with the new shader
+        _isMarchRequested = true;
+    }
+
+    void MarchingCubesComputeSystem::RecordMarch(const VkCommandBuffer commandBuffer)
+    {
+        DBG_ASSERT_MSG(IsAvailable(),
+                       "Cannot march without the Compute Pipeline.");
+
+        ReadGeneratedVertexCount();
+
+        if (!_isMarchRequested)
+        {
+            // The last march's vertices and draw command are still valid
+            return;
+        }
+
+        _isMarchRequested = false;
+
+        const glm::uvec3 gridDimensions = _rSolGrid.GetDimensions();
+        const size_t     cellCount      = (size_t)gridDimensions.x * gridDimensions.y * gridDimensions.z;
+        const glm::uvec3 cubeCounts     = gridDimensions - 1U;
+
+        // The shader works in whole words, the padding cells are never read
+        const VkDeviceSize stateSizeBytes = ((cellCount + CELLS_PER_WORD - 1U) / CELLS_PER_WORD) * CELLS_PER_WORD;
+
+        // A byte per cell is all that goes up, however many vertices it makes
+        const StagingAllocation cellStates = _rSolRenderer.AllocateStagingMemory(stateSizeBytes);
+
+        std::memcpy(cellStates.pMappedData,
+                    _rSolGrid.cells.pCellStates,
+                    cellCount);
+
+        const auto InsertMemoryBarrier = [commandBuffer](const VkAccessFlags srcAccessMask,
+                                                         const VkAccessFlags dstAccessMask,
+                                                         const VkPipelineStageFlags srcStageMask,
+                                                         const VkPipelineStageFlags dstStageMask)
+        {
+            const VkMemoryBarrier memoryBarrier
+            {
+                .sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+                .srcAccessMask = srcAccessMask,
+                .dstAccessMask = dstAccessMask
+            };
+
+            vkCmdPipelineBarrier(commandBuffer,
+                                 srcStageMask,
+                                 dstStageMask,
+                                 0,
+                                 1,
+                                 &memoryBarrier,
+                                 0,
+                                 NULL,
+                                 0,
+                                 NULL);
+        };
+
+        // Earlier frames may still be drawing the last march, or reading the cells
+        InsertMemoryBarrier(0,
+                            0,
+                            VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                            VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+
+        const VkBufferCopy cellStatesCopyRegion
+        {
+            .srcOffset = cellStates.offset,
+            .dstOffset = 0,
+            .size      = stateSizeBytes
+        };
+
+        vkCmdCopyBuffer(commandBuffer,
+                        cellStates.buffer,
+                        _pCellStateBuffer->GetBuffer(),
+                        1,
+                        &cellStatesCopyRegion);
+
+        // The shader counts vertices up from 0
+        vkCmdFillBuffer(commandBuffer,
+                        _pDrawCommandBuffer->GetBuffer(),
+                        0,
+                        VK_WHOLE_SIZE,
+                        0);
+
+        // Also covers the TRI_TABLE, uploaded at the start of the first frame
+        InsertMemoryBarrier(VK_ACCESS_TRANSFER_WRITE_BIT,
+                            VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+                            VK_PIPELINE_STAGE_TRANSFER_BIT,
+                            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+
+        const VkDescriptorBufferInfo cellStatesInfo  = _pCellStateBuffer->DescriptorBufferInfo();
+        const VkDescriptorBufferInfo triTableInfo    = _pTriTableBuffer->DescriptorBufferInfo();
+        const VkDescriptorBufferInfo verticesInfo    = _marchingCubesObject.GetModel()->GetVertexBufferInfo();
+        const VkDescriptorBufferInfo drawCommandInfo = _pDrawCommandBuffer->DescriptorBufferInfo();
+
+        VkDescriptorSet descriptorSet{ VK_NULL_HANDLE };
+
+        // The frame's pool, so the set can point at whichever vertex buffer is current
+        const bool isDescriptorSetBuilt = SolDescriptorWriter(*_pDescriptorSetLayout, _rSolRenderer.GetFrameDescriptorPool()).WriteBuffer(0, &cellStatesInfo)
+                                                                                                                             .WriteBuffer(1, &triTableInfo)
+                                                                                                                             .WriteBuffer(2, &verticesInfo)
+                                                                                                                             .WriteBuffer(3, &drawCommandInfo)
+                                                                                                                             .Build(descriptorSet);
+
+        DBG_ASSERT_MSG(isDescriptorSetBuilt,
+                       "Failed to Build Marching Cubes Descriptor Set.");
+
+        PushConstantData pushConstantData
+        {
+            .gridMinBounds  = _rSolGrid.GetMinBounds(),
+            .cubeCount      = cubeCounts.x * cubeCounts.y * cubeCounts.z,
+            .dimensions     = gridDimensions,
+            .vertexCapacity = _vertexCapacity,
+            .isFinalisePass = 0U
+        };
+
+        vkCmdBindPipeline(commandBuffer,
+                          VK_PIPELINE_BIND_POINT_COMPUTE,
+                          _pipeline);
+
+        vkCmdBindDescriptorSets(commandBuffer,
+                                VK_PIPELINE_BIND_POINT_COMPUTE,
+                                _pipelineLayout,
+                                0,
+                                1,
+                                &descriptorSet,
+                                0,
+                                NULL);
+
+        vkCmdPushConstants(commandBuffer,
+                           _pipelineLayout,
+                           VK_SHADER_STAGE_COMPUTE_BIT,
+                           0,
+                           sizeof(PushConstantData),
+                           &pushConstantData);
+
+        vkCmdDispatch(commandBuffer,
+                      (pushConstantData.cubeCount + WORKGROUP_SIZE - 1U) / WORKGROUP_SIZE,
+                      1,
+                      1);
+
+        // Every workgroup has added its vertices, so the count can be clamped into the draw command
+        InsertMemoryBarrier(VK_ACCESS_SHADER_WRITE_BIT,
+                            VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+                            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+
+        pushConstantData.isFinalisePass = 1U;
+
+        vkCmdPushConstants(commandBuffer,
+                           _pipelineLayout,
+                           VK_SHADER_STAGE_COMPUTE_BIT,
+                           0,
+                           sizeof(PushConstantData),
+                           &pushConstantData);
+
+        vkCmdDispatch(commandBuffer,
+                      1,
+                      1,
+                      1);
+
+        // Make the vertices and draw command visible to this frame's draw
+        InsertMemoryBarrier(VK_ACCESS_SHADER_WRITE_BIT,
+                            VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT,
+                            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                            VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+        // The count is only read once this frame slot comes round again, so the CPU never waits on it
+        const size_t frameIndex = _rSolRenderer.GetFrameIndex();
+
+        const VkBufferCopy vertexCountCopyRegion
+        {
+            .srcOffset = GENERATED_VERTEX_COUNT_OFFSET,
+            .dstOffset = frameIndex * sizeof(uint32_t),
+            .size      = sizeof(uint32_t)
+        };
+
+        vkCmdCopyBuffer(commandBuffer,
+                        _pDrawCommandBuffer->GetBuffer(),
+                        _pVertexCountReadback->GetBuffer(),
+                        1,
+                        &vertexCountCopyRegion);
+
+        InsertMemoryBarrier(VK_ACCESS_TRANSFER_WRITE_BIT,
+                            VK_ACCESS_HOST_READ_BIT,
+                            VK_PIPELINE_STAGE_TRANSFER_BIT,
+                            VK_PIPELINE_STAGE_HOST_BIT);
+
+        _isVertexCountReadbackPending[frameIndex] = true;
+    }
+
+    void MarchingCubesComputeSystem::Dispose()
+    {
+        DestroyPipeline();
+
+        _pDescriptorSetLayout = nullptr;
+
+        _pVertexCountReadback = nullptr;
+        _pDrawCommandBuffer   = nullptr;
+        _pTriTableBuffer      = nullptr;
+        _pCellStateBuffer     = nullptr;
+    }
+
+    void MarchingCubesComputeSystem::CreateBuffers()
+    {
+        // Big enough for the largest grid, so resizing it never recreates anything
+        _pCellStateBuffer = std::make_unique<SolBuffer>(_rSolDevice,
+                                                        sizeof(bool),
+                                                        MAX_CELLS_COUNT,
+                                                        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                                        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        // Widened to ints, as storage buffers can't be read a byte at a time without an extension
+        std::vector<int32_t> triTable(TRI_TABLE_COUNT * TRI_TABLE_INDEX_COUNT);
+
+        for (size_t i(0U); i < TRI_TABLE_COUNT; ++i)
+        {
+            std::copy(std::begin(TRI_TABLE[i]),
+                      std::end(TRI_TABLE[i]),
+                      triTable.begin() + i * TRI_TABLE_INDEX_COUNT);
+        }
+
+        _pTriTableBuffer = std::make_unique<SolBuffer>(_rSolDevice,
+                                                       sizeof(int32_t),
+                                                       (uint32_t)triTable.size(),
+                                                       VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                                       VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        _rSolRenderer.UploadToBuffer(_pTriTableBuffer->GetBuffer(),
+                                     triTable.data(),
+                                     triTable.size() * sizeof(int32_t));
+
+        // A VkDrawIndirectCommand, then the uncapped vertex count
+        _pDrawCommandBuffer = std::make_unique<SolBuffer>(_rSolDevice,
+                                                          sizeof(uint32_t),
+                                                          (uint32_t)((GENERATED_VERTEX_COUNT_OFFSET / sizeof(uint32_t)) + 1U),
+                                                          VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                                          VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        _pVertexCountReadback = std::make_unique<SolBuffer>(_rSolDevice,
+                                                            sizeof(uint32_t),
+                                                            SolSwapchain::MAX_FRAMES_IN_FLIGHT,
+                                                            VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        const VkResult result = _pVertexCountReadback->Map();
+
+        DBG_ASSERT_VULKAN_MSG(result,
+                              "Failed to Map Vertex Count Readback Buffer.");
+    }
+
+    void MarchingCubesComputeSystem::CreateDescriptorSetLayout()
+    {
+        _pDescriptorSetLayout = SolDescriptorSetLayout::Builder(_rSolDevice).AddBinding(0,     // Cell States
+                                                                                        VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                                        VK_SHADER_STAGE_COMPUTE_BIT)
+                                                                            .AddBinding(1,     // TRI_TABLE
+                                                                                        VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                                        VK_SHADER_STAGE_COMPUTE_BIT)
+                                                                            .AddBinding(2,     // Vertices
+                                                                                        VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                                        VK_SHADER_STAGE_COMPUTE_BIT)
+                                                                            .AddBinding(3,     // Draw Command
+                                                                                        VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                                        VK_SHADER_STAGE_COMPUTE_BIT)
+                                                                            .Build();
+    }
+
+    void MarchingCubesComputeSystem::DestroyPipeline()
+    {
+        vkDestroyPipeline(_rSolDevice.GetDevice(),
+                          _pipeline,
+                          NULL);
+
+        vkDestroyPipelineLayout(_rSolDevice.GetDevice(),
+                                _pipelineLayout,
+                                NULL);
+
+        _pipeline       = VK_NULL_HANDLE;
+        _pipelineLayout = VK_NULL_HANDLE;
+    }
+
+    void MarchingCubesComputeSystem::CreatePipeline()
+    {
+        const VkShaderModule computeShaderModule = _rSolShaderLibrary.GetShaderModule(COMPUTE_SHADER_PATH);
+
+        if (computeShaderModule == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        const VkPushConstantRange pushConstantRange
+        {
+            .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+            .offset     = 0,
+            .size       = sizeof(PushConstantData)
+        };
+
+        const VkDescriptorSetLayout descriptorSetLayout = _pDescriptorSetLayout->GetDescriptorSetLayout();
+
+        const VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo
+        {
+            .sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+            .setLayoutCount         = 1,
+            .pSetLayouts            = &descriptorSetLayout,
+            .pushConstantRangeCount = 1,
+            .pPushConstantRanges    = &pushConstantRange
+        };
+
+        VkResult result = vkCreatePipelineLayout(_rSolDevice.GetDevice(),
+                                                 &pipelineLayoutCreateInfo,
+                                                 NULL,
+                                                 &_pipelineLayout);
+
+        DBG_ASSERT_VULKAN_MSG(result,
+                              "Failed to Create Marching Cubes Pipeline Layout.");
+
+        const VkComputePipelineCreateInfo pipelineCreateInfo
+        {
+            .sType  = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+            .stage  = VkPipelineShaderStageCreateInfo
+            {
+                .sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+                .stage  = VK_SHADER_STAGE_COMPUTE_BIT,
+                .module = computeShaderModule,
+                .pName  = "main"
+            },
+            .layout = _pipelineLayout
+        };
+
+        result = vkCreateComputePipelines(_rSolDevice.GetDevice(),
+                                          _rSolDevice.GetPipelineCache(),
+                                          1,
+                                          &pipelineCreateInfo,
+                                          NULL,
+                                          &_pipeline);
+
+        DBG_ASSERT_VULKAN_MSG(result,
+                              "Failed to Create Marching Cubes Pipeline.");
+
+        if (result != VK_SUCCESS)
+        {
+            _pipeline = VK_NULL_HANDLE;
+        }
+    }
+
+    void MarchingCubesComputeSystem::ResizeVertexBuffer(const uint32_t vertexCapacity)
+    {
+        const std::shared_ptr<SolModel> pPreviousModel = _marchingCubesObject.GetModel();
+
+        if (pPreviousModel != nullptr)
+        {
+            // Frames in flight may still be drawing it
+            _rSolRenderer.DeferRelease(pPreviousModel);
+        }
+
+        _marchingCubesObject.SetModel(std::make_shared<SolModel>(_rSolDevice,
+                                                                 _rSolRenderer,
+                                                                 vertexCapacity,
+                                                                 VK_BUFFER_USAGE_STORAGE_BUFFER_BIT));
+
+        _vertexCapacity = vertexCapacity;
+    }
+
+    void MarchingCubesComputeSystem::ReadGeneratedVertexCount()
+    {
+        const size_t frameIndex = _rSolRenderer.GetFrameIndex();
+
+        if (!_isVertexCountReadbackPending[frameIndex])
+        {
+            return;
+        }
+
+        _isVertexCountReadbackPending[frameIndex] = false;
+
+        // BeginFrame waited on this slot's fence, so the copy has landed
+        const uint32_t generatedVertexCount = static_cast<const uint32_t*>(_pVertexCountReadback->GetMappedMemory())[frameIndex];
+        const uint32_t vertexCount          = (std::min)(generatedVertexCount, _vertexCapacity);
+
+        // Update Diagnostic Data, a few frames behind the mesh being drawn
+        _rDiagnosticData.vertexCount                  = vertexCount;
+        _rDiagnosticData.triCount                     = vertexCount / 3U;
+        _rDiagnosticData.drawnVertexCount             = vertexCount;
+        _rDiagnosticData.verticesMemoryAllocatedBytes = (size_t)_vertexCapacity * sizeof(Vertex);
+        _rDiagnosticData.verticesMemoryUsedBytes      = (size_t)vertexCount * sizeof(Vertex);
+
+        if (generatedVertexCount <= _vertexCapacity)
+        {
+            return;
+        }
+
+        // Some of the mesh was cut off, so grow to fit it and march again
+        ResizeVertexBuffer((uint32_t)(generatedVertexCount * VERTEX_CAPACITY_GROWTH));
+
+        _isMarchRequested = true;
+    }
+}
@@ -0,0 +1,112 @@
+#pragma once
+#include "SolShaderLibrary.hpp"
+#include "SolDescriptorWriter.hpp"
+#include "SolGrid.hpp"
+#include "SolGameObject.hpp"
+#include "SolRenderer.hpp"
+
+using namespace SolEngine::Descriptors;
+
+namespace SolEngine::System
+{
+    /// <summary>
+    /// Marches the cells' midpoint surface with a compute shader, writing the vertices and their draw command on the GPU.
+    /// Only the cells are uploaded, a byte each, rather than the mesh. The vertex count never comes back to the CPU to draw.
+    /// </summary>
+    class MarchingCubesComputeSystem : private IDisposable
+    {
+    public:
+        MarchingCubesComputeSystem(SolDevice& rSolDevice, SolRenderer& rSolRenderer, SolShaderLibrary& rSolShaderLibrary,
+                                   SolGrid& rSolGrid, DiagnosticData& rDiagnosticData);
+        ~MarchingCubesComputeSystem();
+
+        MarchingCubesComputeSystem(const MarchingCubesComputeSystem&)            = delete;
+        MarchingCubesComputeSystem& operator=(const MarchingCubesComputeSystem&) = delete;
+
+        /// <summary>
+        /// False if Shaders/MarchingCubes.comp.spv hasn't been compiled, in which case the CPU has to march the cells.
+        /// </summary>
+        bool IsAvailable() const { return _pipeline != VK_NULL_HANDLE; }
+
+        SolGameObject& GetGameObject() { return _marchingCubesObject; }
+
+        /// <summary>
+        /// Holds the VkDrawIndirectCommand for the game object's model, written by the last march.
+        /// </summary>
+        VkBuffer GetDrawCommandBuffer() const { return _pDrawCommandBuffer->GetBuffer(); }
+
+        /// <summary>
+        /// Marches the current cells in the upcoming frame, see RecordMarch.
+        /// </summary>
+        void March() { _isMarchRequested = true; }
+        void ResetVerticesContainerSize();
+
+        /// <summary>
+        /// Records the march into the frame's primary command buffer, if one was requested, before the render pass begins.
+        /// Also picks up the vertex count of the last march this frame slot recorded, to grow the vertex buffer and for diagnostics.
+        /// </summary>
+        void RecordMarch(const VkCommandBuffer commandBuffer);
+
+        /// <summary>
+        /// Rebuilds the pipeline from the shader library's current module, e.g. after the shader was hot reloaded.
+        /// </summary>
+        void RebuildPipeline();
+
+    private:
+        static constexpr const char*  COMPUTE_SHADER_PATH          { "Shaders/MarchingCubes.comp.spv" };
+        static constexpr uint32_t     WORKGROUP_SIZE               { 64U };     // Matches local_size_x
+        static constexpr uint32_t     CELLS_PER_WORD               { 4U };      // Cells are a byte each, the shader reads them 4 at a time
+        static constexpr uint32_t     MIN_VERTEX_CAPACITY          { 1024U * 1024U };
+        static constexpr float        VERTEX_CAPACITY_GROWTH       { 1.5f };    // Room to grow, so a growing mesh doesn't resize every generation
+        static constexpr VkDeviceSize GENERATED_VERTEX_COUNT_OFFSET{ sizeof(VkDrawIndirectCommand) };    // Follows the draw command
+
+        struct PushConstantData
+        {
+            glm::ivec3 gridMinBounds;
+            uint32_t   cubeCount;
+            glm::uvec3 dimensions;
+            uint32_t   vertexCapacity;
+            uint32_t   isFinalisePass;
+        };
+
+        // Inherited via IDisposable
+        virtual void Dispose() override;
+
+        void CreateBuffers();
+        void CreateDescriptorSetLayout();
+        void CreatePipeline();
+        void DestroyPipeline();
+
+        /// <summary>
+        /// Swaps the game object's model for an empty one of the given capacity, the old one is released once the GPU has finished with it.
+        /// </summary>
+        void ResizeVertexBuffer(const uint32_t vertexCapacity);
+
+        /// <summary>
+        /// Reads the generated vertex count back from this frame slot's last march, whose frame has finished by now.
+        /// </summary>
+        void ReadGeneratedVertexCount();
+
+        SolDevice&        _rSolDevice;
+        SolRenderer&      _rSolRenderer;
+        SolShaderLibrary& _rSolShaderLibrary;
+        SolGrid&          _rSolGrid;
+        DiagnosticData&   _rDiagnosticData;
+        SolGameObject     _marchingCubesObject;
+
+        bool     _isMarchRequested{ false };
+        uint32_t _vertexCapacity  { 0U };
+
+        std::unique_ptr<SolBuffer> _pCellStateBuffer     {};
+        std::unique_ptr<SolBuffer> _pTriTableBuffer      {};
+        std::unique_ptr<SolBuffer> _pDrawCommandBuffer   {};
+        std::unique_ptr<SolBuffer> _pVertexCountReadback {};    // Host visible, a generated vertex count per frame in flight
+
+        bool _isVertexCountReadbackPending[SolSwapchain::MAX_FRAMES_IN_FLIGHT]{};
+
+        std::unique_ptr<SolDescriptorSetLayout> _pDescriptorSetLayout{};    // Sets come from the frame's pool, as the vertex buffer can change
+
+        VkPipelineLayout _pipelineLayout{ VK_NULL_HANDLE };
+        VkPipeline       _pipeline      { VK_NULL_HANDLE };
+    };
+}
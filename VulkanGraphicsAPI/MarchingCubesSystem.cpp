@@ -1,186 +1,542 @@
+#include <bit>
+#include <emmintrin.h>
+
 #include "MarchingCubesSystem.hpp"
 
 namespace SolEngine::System
 {
     MarchingCubesSystem::MarchingCubesSystem(SolDevice& rSolDevice, 
+                                             SolRenderer& rSolRenderer,
                                              SolGrid& rSolGrid,
+                                             RenderSettings& rRenderSettings,
                                              DiagnosticData& rDiagnosticData)
         : _rSolDevice(rSolDevice),
+          _rSolRenderer(rSolRenderer),
           _rSolGrid(rSolGrid),
+          _rRenderSettings(rRenderSettings),
           _rDiagnosticData(rDiagnosticData),
           _marchingCubesObject(SolGameObject::CreateGameObject())
-    {}
+    {
+        // Skip the Staging Buffer and copy when the CPU can write to the GPU's memory directly
+        _uploadStrategy = _rSolDevice.IsDeviceLocalHostVisibleMemorySupported() ? MeshUploadStrategy::DIRECT_WRITE 
+                                                                                 : MeshUploadStrategy::STAGED;
+
+        DebugHelpers::DPrintf("Mesh Upload Strategy: %s\n", 
+                              (_uploadStrategy == MeshUploadStrategy::DIRECT_WRITE) ? "Direct Write" : "Staged");
+    }
 
     void MarchingCubesSystem::March()
     {
-        // Start back at the beginning of the array
-        // To re-use vertices.
-        _verticesInUseCount = 0U;
+        _isoSurfaceType = _rRenderSettings.isoSurfaceType;
+
+        if (_isoSurfaceType == IsoSurfaceType::NEIGHBOUR_DENSITY)
+        {
+            UpdateLiveNeighbourCounts();
+        }
 
-        const glm::uvec3  gridDimensions  = _rSolGrid.GetDimensions();
-        const bool*       pGridCellStates = _rSolGrid.cells.pCellStates;
-
-        _rSolGrid.TraverseAllGridCells([&](const int xIndex, 
-                                           const int yIndex, 
-                                           const int zIndex) 
-                                       {
-                                           bool cubeIsoValues[CUBE_VERTEX_COUNT]{ 0 };
-
-                                           // Retrieve the cubes "Iso Values" using the grid cell states
-                                           GetCubeIsoValues(cubeIsoValues, 
-                                                            pGridCellStates,
-                                                            xIndex, 
-                                                            yIndex, 
-                                                            zIndex, 
-                                                            gridDimensions);
-                                       
-                                           // Calculate the cube index to pull from the Tri-table
-                                           const uint32_t cubeIndex = GetCubeIndex(cubeIsoValues);
-                                       
-                                           // Look up the triangulation for the cubeIndex
-                                           const Index_t* pEdgeIndices = TRI_TABLE[cubeIndex];
-
-                                           if (*pEdgeIndices == -1)
-                                           {
-                                               return;
-                                           }
-                                       
-                                           CreateVertices(_rSolGrid.cells,
-                                                          pEdgeIndices, 
-                                                          xIndex, 
-                                                          yIndex, 
-                                                          zIndex);
-                                       });
-
-        UpdateGameObjectModel();
+        UpdateLodGrids();
+
+        if (_uploadStrategy == MeshUploadStrategy::DIRECT_WRITE)
+        {
+            MarchIntoMappedModel();
+        }
+        else
+        {
+            MarchGridCells();
+            UpdateGameObjectModel();
+        }
 
         // Update Diagnostic Data
         const size_t vertexSizeBytes = sizeof(Vertex);
-        _rDiagnosticData.vertexCount                  = _verticesInUseCount;
-        _rDiagnosticData.triCount                     = _verticesInUseCount / 3U;
-        _rDiagnosticData.verticesMemoryAllocatedBytes = _vertices.size() * vertexSizeBytes;
+        const size_t vertexCapacity  = (_uploadStrategy == MeshUploadStrategy::DIRECT_WRITE) ? _mappedVertexCapacity : _vertices.size();
+
+        // The lower levels of detail share the vertex buffer, only the full resolution mesh is counted
+        size_t meshVertexCount = 0U;
+
+        for (const MeshChunk& chunk : _chunks)
+        {
+            meshVertexCount += chunk.vertexCounts[0];
+        }
+
+        _rDiagnosticData.vertexCount                  = meshVertexCount;
+        _rDiagnosticData.triCount                     = meshVertexCount / 3U;
+        _rDiagnosticData.verticesMemoryAllocatedBytes = vertexCapacity * vertexSizeBytes;
         _rDiagnosticData.verticesMemoryUsedBytes      = _verticesInUseCount * vertexSizeBytes;
     }
 
-    uint32_t MarchingCubesSystem::GetCubeIndex(const bool* pNodeStates)
+    void MarchingCubesSystem::MarchGridCells()
     {
-        uint32_t cubeIndex(0);
+        // Start back at the beginning of the array
+        // To re-use vertices.
+        _verticesInUseCount = 0U;
 
-        for (uint32_t i(0); i < CUBE_VERTEX_COUNT; ++i)
+        const glm::uvec3 gridDimensions = _rSolGrid.GetDimensions();
+
+        _chunks.clear();
+
+        // March a block of cells at a time, so each chunk's vertices are contiguous and can be drawn or culled on their own
+        const glm::uvec3 chunkCounts = (gridDimensions + CHUNK_CELLS_PER_AXIS - 1U) / CHUNK_CELLS_PER_AXIS;
+
+        for (uint32_t zChunk(0U); zChunk < chunkCounts.z; ++zChunk)
         {
-            if (!pNodeStates[i])
+            for (uint32_t yChunk(0U); yChunk < chunkCounts.y; ++yChunk)
             {
-                continue;
+                for (uint32_t xChunk(0U); xChunk < chunkCounts.x; ++xChunk)
+                {
+                    const glm::uvec3 minCellIndices = glm::uvec3(xChunk, yChunk, zChunk) * CHUNK_CELLS_PER_AXIS;
+                    const glm::uvec3 maxCellIndices = glm::min(minCellIndices + CHUNK_CELLS_PER_AXIS, gridDimensions);
+
+                    const size_t firstVertex = _verticesInUseCount;
+
+                    MeshChunk chunk{ .lodCount = MeshChunk::MAX_LOD_COUNT };
+
+                    _chunkMinBounds = glm::vec3( FLT_MAX);
+                    _chunkMaxBounds = glm::vec3(-FLT_MAX);
+
+                    // Every level follows the last, so the renderer can pick one per chunk
+                    for (uint32_t lod(0U); lod < MeshChunk::MAX_LOD_COUNT; ++lod)
+                    {
+                        chunk.firstVertices[lod] = (uint32_t)_verticesInUseCount;
+
+                        MarchChunkLod(_lodGrids.at(lod), 
+                                      minCellIndices, 
+                                      maxCellIndices);
+
+                        chunk.vertexCounts[lod] = (uint32_t)(_verticesInUseCount - chunk.firstVertices[lod]);
+                    }
+
+                    if (_verticesInUseCount == firstVertex)
+                    {
+                        continue;
+                    }
+
+                    chunk.minBounds = _chunkMinBounds;
+                    chunk.maxBounds = _chunkMaxBounds;
+
+                    _chunks.push_back(chunk);
+                }
             }
+        }
+    }
+
+    void MarchingCubesSystem::MarchIntoMappedModel()
+    {
+        // Size for the last mesh with room to grow
+        const size_t expectedVertexCount = _verticesInUseCount + _verticesInUseCount / 2U;
+
+        std::shared_ptr<SolModel> pMarchingCubeModel = AcquireMappedModel((std::max)(expectedVertexCount, 
+                                                                                     MIN_MAPPED_VERTEX_CAPACITY));
+
+        _pMappedVertices      = pMarchingCubeModel->GetMappedVertices();
+        _mappedVertexCapacity = pMarchingCubeModel->GetVertexCapacity();
+
+        MarchGridCells();
+
+        // Outgrew it, the GPU has never seen this buffer so swap it for one that fits and march again
+        if (_verticesInUseCount > _mappedVertexCapacity)
+        {
+            pMarchingCubeModel = AcquireMappedModel(_verticesInUseCount + _verticesInUseCount / 2U);
+
+            _pMappedVertices      = pMarchingCubeModel->GetMappedVertices();
+            _mappedVertexCapacity = pMarchingCubeModel->GetVertexCapacity();
 
-            cubeIndex |= 1 << i;
+            MarchGridCells();
         }
 
-        return cubeIndex;
+        _pMappedVertices = nullptr;
+
+        pMarchingCubeModel->SetVertexCount((uint32_t)_verticesInUseCount);
+        pMarchingCubeModel->SetChunks(_chunks);
+
+        RetireGameObjectModel();
+        _marchingCubesObject.SetModel(pMarchingCubeModel);
     }
 
-    void MarchingCubesSystem::GetCubeIsoValues(bool* pOutCubeIsoValues, 
-                                               const bool* pGridCellStates, 
-                                               const int xIndex, 
-                                               const int yIndex, 
-                                               const int zIndex, 
-                                               const glm::vec3& gridDimensions)
+    void MarchingCubesSystem::UpdateLodGrids()
     {
-        const int adjOffset = 1;
-        const int adjXIndex = xIndex + adjOffset;
-        const int adjYIndex = yIndex + adjOffset;
-        const int adjZIndex = zIndex + adjOffset;
+        const glm::uvec3 gridDimensions  = _rSolGrid.GetDimensions();
+        const bool*      pGridCellStates = _rSolGrid.cells.pCellStates;
+        const size_t     rowSize         = gridDimensions.x;
+        const size_t     sliceSize       = rowSize * gridDimensions.y;
 
-        if (!(adjXIndex < gridDimensions.x) ||
-            !(adjYIndex < gridDimensions.y) ||
-            !(adjZIndex < gridDimensions.z))
+        LodGrid& rFullGrid = _lodGrids.front();
+
+        rFullGrid.pCellStates = pGridCellStates;
+        rFullGrid.dimensions  = gridDimensions;
+        rFullGrid.cellSize    = 1U;
+
+        for (uint32_t lod(1U); lod < MeshChunk::MAX_LOD_COUNT; ++lod)
         {
-            // Out-of-range
-            return;
+            LodGrid& rLodGrid = _lodGrids.at(lod);
+
+            const uint32_t   cellSize      = 1U << lod;
+            const glm::uvec3 lodDimensions = (gridDimensions + cellSize - 1U) / cellSize;
+            const size_t     lodCellCount  = (size_t)lodDimensions.x * lodDimensions.y * lodDimensions.z;
+
+            if (lodCellCount > rLodGrid.ownedCapacity)
+            {
+                rLodGrid.pOwnedStates  = std::make_unique<bool[]>(lodCellCount);
+                rLodGrid.ownedCapacity = lodCellCount;
+            }
+
+            bool*  pLodCellStates = rLodGrid.pOwnedStates.get();
+            size_t lodIndex(0U);
+
+            for (uint32_t zIndex(0U); zIndex < lodDimensions.z; ++zIndex)
+            {
+                for (uint32_t yIndex(0U); yIndex < lodDimensions.y; ++yIndex)
+                {
+                    for (uint32_t xIndex(0U); xIndex < lodDimensions.x; ++xIndex, ++lodIndex)
+                    {
+                        const glm::uvec3 minCellIndices = glm::uvec3(xIndex, yIndex, zIndex) * cellSize;
+                        const glm::uvec3 maxCellIndices = glm::min(minCellIndices + cellSize, gridDimensions);
+
+                        uint32_t aliveCount(0U);
+
+                        for (uint32_t cellZIndex(minCellIndices.z); cellZIndex < maxCellIndices.z; ++cellZIndex)
+                        {
+                            for (uint32_t cellYIndex(minCellIndices.y); cellYIndex < maxCellIndices.y; ++cellYIndex)
+                            {
+                                const bool* pRow = pGridCellStates + (cellZIndex * sliceSize) + (cellYIndex * rowSize);
+
+                                for (uint32_t cellXIndex(minCellIndices.x); cellXIndex < maxCellIndices.x; ++cellXIndex)
+                                {
+                                    aliveCount += pRow[cellXIndex];
+                                }
+                            }
+                        }
+
+                        // Cells on the far faces can cover fewer grid cells, so only count those inside it
+                        const glm::uvec3 coveredCellCounts = maxCellIndices - minCellIndices;
+
+                        pLodCellStates[lodIndex] = aliveCount * 2U >= coveredCellCounts.x * coveredCellCounts.y * coveredCellCounts.z;
+                    }
+                }
+            }
+
+            rLodGrid.pCellStates = pLodCellStates;
+            rLodGrid.dimensions  = lodDimensions;
+            rLodGrid.cellSize    = cellSize;
+        }
+    }
+
+    void MarchingCubesSystem::MarchChunkLod(const LodGrid& lodGrid, 
+                                            const glm::uvec3& minCellIndices, 
+                                            const glm::uvec3& maxCellIndices)
+    {
+        _pMarchedLodGrid = &lodGrid;
+
+        // Chunks are a multiple of every level's cell size, except where they're cut short by the grid's far faces
+        glm::uvec3 minCubeIndices = minCellIndices / lodGrid.cellSize;
+        glm::uvec3 maxCubeIndices = (maxCellIndices + lodGrid.cellSize - 1U) / lodGrid.cellSize;
+
+        // A coarser surface won't meet a finer neighbour's at the chunk's faces, 
+        // so it overlaps a cube into each neighbour to cover the cracks
+        if (lodGrid.cellSize > 1U)
+        {
+            minCubeIndices = glm::max(minCubeIndices, glm::uvec3(1U)) - 1U;
+            maxCubeIndices = maxCubeIndices + 1U;
+        }
+
+        // Cubes on the far faces have no neighbouring corners, so are never marched
+        maxCubeIndices = glm::min(maxCubeIndices, lodGrid.dimensions - 1U);
+
+        for (uint32_t zIndex(minCubeIndices.z); zIndex < maxCubeIndices.z; ++zIndex)
+        {
+            for (uint32_t yIndex(minCubeIndices.y); yIndex < maxCubeIndices.y; ++yIndex)
+            {
+                MarchRow(yIndex, 
+                         zIndex, 
+                         minCubeIndices.x, 
+                         maxCubeIndices.x);
+            }
+        }
+    }
+
+    void MarchingCubesSystem::MarchRow(const uint32_t yIndex, 
+                                       const uint32_t zIndex, 
+                                       const uint32_t minXIndex, 
+                                       const uint32_t maxXIndex)
+    {
+        const glm::uvec3 gridDimensions  = _pMarchedLodGrid->dimensions;
+        const bool*      pGridCellStates = _pMarchedLodGrid->pCellStates;
+        const size_t     rowSize         = gridDimensions.x;
+        const size_t     sliceSize       = rowSize * gridDimensions.y;
+        const size_t     rowIndex        = (zIndex * sliceSize) + (yIndex * rowSize);
+
+        // The four rows holding the corners of every cube along this row, in column bit order
+        const bool* pCornerRows[CUBE_COLUMN_CORNER_COUNT]
+        {
+            pGridCellStates + rowIndex,                         // (y, z)
+            pGridCellStates + rowIndex + sliceSize,             // (y, z + 1)
+            pGridCellStates + rowIndex + rowSize,               // (y + 1, z)
+            pGridCellStates + rowIndex + rowSize + sliceSize    // (y + 1, z + 1)
+        };
+
+        for (uint32_t blockXIndex(minXIndex); blockXIndex < maxXIndex; blockXIndex += ROW_BLOCK_CUBE_COUNT)
+        {
+            const uint32_t blockCubeCount = (std::min)(ROW_BLOCK_CUBE_COUNT, maxXIndex - blockXIndex);
+
+            // A bit per column for each corner row, one more column than cubes for the far corners
+            uint64_t cornerRowMasks[CUBE_COLUMN_CORNER_COUNT];
+
+            for (uint32_t i(0U); i < CUBE_COLUMN_CORNER_COUNT; ++i)
+            {
+                cornerRowMasks[i] = LoadColumnMask(pCornerRows[i] + blockXIndex, 
+                                                   blockCubeCount + 1U);
+            }
+
+            const uint64_t anyAliveColumns = cornerRowMasks[0] | cornerRowMasks[1] | cornerRowMasks[2] | cornerRowMasks[3];
+            const uint64_t allAliveColumns = cornerRowMasks[0] & cornerRowMasks[1] & cornerRowMasks[2] & cornerRowMasks[3];
+
+            // A cube spans two columns, it has no triangles if both are empty or both are full
+            const uint64_t blockCubesMask = (1ULL << blockCubeCount) - 1ULL;
+            const uint64_t emptyCubes     = ~(anyAliveColumns | (anyAliveColumns >> 1));
+            const uint64_t fullCubes      = allAliveColumns & (allAliveColumns >> 1);
+
+            uint64_t activeCubes = blockCubesMask & ~(emptyCubes | fullCubes);
+
+            const auto GetColumnBits = [&cornerRowMasks](const uint32_t column)
+            {
+                return (uint32_t)(((cornerRowMasks[0] >> column) & 1U)       |
+                                  ((cornerRowMasks[1] >> column) & 1U) << 1  |
+                                  ((cornerRowMasks[2] >> column) & 1U) << 2  |
+                                  ((cornerRowMasks[3] >> column) & 1U) << 3);
+            };
+
+            // Two columns of corner bits, the cube's near column in the low nibble
+            uint32_t columnWindow(0U);
+            int      previousCube(-2);
+
+            while (activeCubes != 0U)
+            {
+                const int cube = std::countr_zero(activeCubes);
+
+                activeCubes &= activeCubes - 1U;
+
+                // Neighbouring cubes share a column, so only the new far column needs shifting in
+                if (cube == previousCube + 1)
+                {
+                    columnWindow = (columnWindow >> CUBE_COLUMN_CORNER_COUNT) | (GetColumnBits(cube + 1) << CUBE_COLUMN_CORNER_COUNT);
+                }
+                else
+                {
+                    columnWindow = GetColumnBits(cube) | (GetColumnBits(cube + 1) << CUBE_COLUMN_CORNER_COUNT);
+                }
+
+                previousCube = cube;
+
+                // Look up the triangulation for the cubeIndex
+                const Index_t* pEdgeIndices = TRI_TABLE[COLUMN_WINDOW_TO_CUBE_INDEX[columnWindow]];
+
+                CreateVertices(pEdgeIndices, 
+                               blockXIndex + cube, 
+                               yIndex, 
+                               zIndex);
+            }
+        }
+    }
+
+    uint64_t MarchingCubesSystem::LoadColumnMask(const bool* pColumns, 
+                                                 const uint32_t columnCount)
+    {
+        uint64_t columnMask(0U);
+        uint32_t column(0U);
+
+        // Bools are 0 or 1, so shifting each byte's bit up to its sign bit lets movemask gather 16 at once
+        for (; column + SIMD_BYTE_COUNT <= columnCount; column += SIMD_BYTE_COUNT)
+        {
+            const __m128i columns = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pColumns + column));
+
+            columnMask |= (uint64_t)_mm_movemask_epi8(_mm_slli_epi16(columns, 7)) << column;
+        }
+
+        for (; column < columnCount; ++column)
+        {
+            columnMask |= (uint64_t)pColumns[column] << column;
         }
 
-        // Retrieve a "Cube" of cell states
-        pOutCubeIsoValues[0] = pGridCellStates[_3DTo1DIndex(xIndex,    yIndex,    zIndex,    gridDimensions)];
-        pOutCubeIsoValues[1] = pGridCellStates[_3DTo1DIndex(adjXIndex, yIndex,    zIndex,    gridDimensions)];
-        pOutCubeIsoValues[2] = pGridCellStates[_3DTo1DIndex(adjXIndex, yIndex,    adjZIndex, gridDimensions)];
-        pOutCubeIsoValues[3] = pGridCellStates[_3DTo1DIndex(xIndex,    yIndex,    adjZIndex, gridDimensions)];
-        pOutCubeIsoValues[4] = pGridCellStates[_3DTo1DIndex(xIndex,    adjYIndex, zIndex,    gridDimensions)];
-        pOutCubeIsoValues[5] = pGridCellStates[_3DTo1DIndex(adjXIndex, adjYIndex, zIndex,    gridDimensions)];
-        pOutCubeIsoValues[6] = pGridCellStates[_3DTo1DIndex(adjXIndex, adjYIndex, adjZIndex, gridDimensions)];
-        pOutCubeIsoValues[7] = pGridCellStates[_3DTo1DIndex(xIndex,    adjYIndex, adjZIndex, gridDimensions)];
+        return columnMask;
     }
 
-    void MarchingCubesSystem::CreateVertices(Cells& rNodes,
-                                             const Index_t* pEdgeIndices, 
+    void MarchingCubesSystem::CreateVertices(const Index_t* pEdgeIndices, 
                                              const int xIndex, 
                                              const int yIndex, 
                                              const int zIndex)
     {
-        const glm::uvec3 gridDimensions = _rSolGrid.GetDimensions();
+        // Coloured by grid position, so every level of detail matches
+        const glm::uvec3 lodDimensions = _pMarchedLodGrid->dimensions;
 
-        for (uint32_t i(0); i < TRI_TABLE_INDEX_COUNT; ++i)
+        const glm::vec3 vertexColour
+        {
+            (float)xIndex / lodDimensions.x,  // r
+            (float)yIndex / lodDimensions.y,  // g
+            (float)zIndex / lodDimensions.z   // b
+        };
+
+        for (uint32_t i(0); i < TRI_TABLE_INDEX_COUNT; i += TRIANGLE_VERTEX_COUNT)
         {
             if (pEdgeIndices[i] == -1)
             {
                 return;
             }
 
-            // Find the 2 corners that create the edge
-            const std::pair<Index_t, Index_t> cornerIndices = 
-                CornerIndicesFromEdgeIndex(pEdgeIndices[i]);
-
-            // Find edge midpoint
-            const glm::vec3 vertexPosition = GetEdgeVertexPosition(rNodes,
-                                                                   xIndex,
-                                                                   yIndex,
-                                                                   zIndex, 
-                                                                   cornerIndices);
+            // Find edge midpoints
+            glm::vec3 trianglePositions[TRIANGLE_VERTEX_COUNT];
 
-            const glm::vec3 vertexColour
+            for (uint32_t j(0); j < TRIANGLE_VERTEX_COUNT; ++j)
             {
-                (float)xIndex / gridDimensions.x,  // r
-                (float)yIndex / gridDimensions.y,  // g
-                (float)zIndex / gridDimensions.z   // b
-            };
+                trianglePositions[j] = GetEdgeVertexPosition(xIndex,
+                                                             yIndex,
+                                                             zIndex, 
+                                                             pEdgeIndices[i + j]);
+            }
+
+            // TRI_TABLE winds towards the live corners, so flip it to point out of the surface
+            const glm::vec3 faceDirection = glm::cross(trianglePositions[2] - trianglePositions[0], 
+                                                       trianglePositions[1] - trianglePositions[0]);
+            const float     faceLength    = glm::length(faceDirection);
+            const glm::vec3 faceNormal    = (faceLength > 0.f) ? faceDirection / faceLength : glm::vec3(0.f);
 
-            if (_verticesInUseCount < _vertices.size())
+            for (const glm::vec3& vertexPosition : trianglePositions)
             {
-                // Re-use initialised vertices...
-                _vertices.at(_verticesInUseCount).position = vertexPosition;
-                _vertices.at(_verticesInUseCount).colour   = vertexColour;
+                _chunkMinBounds = glm::min(_chunkMinBounds, vertexPosition);
+                _chunkMaxBounds = glm::max(_chunkMaxBounds, vertexPosition);
+
+                AddVertex(Vertex{ vertexPosition, vertexColour, faceNormal });
             }
-            else
+        }
+    }
+
+    void MarchingCubesSystem::AddVertex(const Vertex& vertex)
+    {
+        if (_pMappedVertices != nullptr)
+        {
+            // Written whole and in order, which suits write-combined memory.
+            // Anything past the end is only counted, so the buffer can be grown to fit.
+            if (_verticesInUseCount < _mappedVertexCapacity)
             {
-                // Expand storage if necessary...
-                _vertices.push_back(Vertex{ vertexPosition, vertexColour });
+                _pMappedVertices[_verticesInUseCount] = vertex;
             }
-
-            ++_verticesInUseCount;
         }
+        else if (_verticesInUseCount < _vertices.size())
+        {
+            // Re-use initialised vertices...
+            _vertices.at(_verticesInUseCount) = vertex;
+        }
+        else
+        {
+            // Expand storage if necessary...
+            _vertices.push_back(vertex);
+        }
+
+        ++_verticesInUseCount;
     }
 
-    glm::vec3 MarchingCubesSystem::GetEdgeVertexPosition(Cells& rNodes, 
-                                                         const int xIndex,
+    glm::vec3 MarchingCubesSystem::GetEdgeVertexPosition(const int xIndex,
                                                          const int yIndex, 
                                                          const int zIndex, 
-                                                         const std::pair<Index_t, Index_t>& cornerIndices)
+                                                         const Index_t edgeIndex)
     {
-        const int xRowWidth = xIndex * CUBE_VERTEX_COUNT;
-        const int yRowWidth = yIndex * CUBE_VERTEX_COUNT;
-        const int zRowWidth = zIndex * CUBE_VERTEX_COUNT;
+        const glm::ivec3& gridMinBounds = _rSolGrid.GetMinBounds();
+        const float       cellSize      = (float)_pMarchedLodGrid->cellSize;
 
-        const int* pXVertices = &rNodes.pXVertices[xRowWidth];
-        const int* pYVertices = &rNodes.pYVertices[yRowWidth];
-        const int* pZVertices = &rNodes.pZVertices[zRowWidth];
+        // A downsampled cell sits at the centre of the grid cells it covers
+        const float cellCentreOffset = (cellSize - 1.f) * 0.5f;
 
-        const Index_t indexA = cornerIndices.first;
-        const Index_t indexB = cornerIndices.second;
+        // The grid's y-axis runs downwards from its min bounds
+        const glm::vec3 cubeOrigin
+        {
+            gridMinBounds.x + xIndex * cellSize + cellCentreOffset,
+            gridMinBounds.y - yIndex * cellSize - cellCentreOffset,
+            gridMinBounds.z + zIndex * cellSize + cellCentreOffset
+        };
 
-        const float half = 0.5f;
+        // Neighbour counts are only kept at full resolution
+        if (_isoSurfaceType != IsoSurfaceType::NEIGHBOUR_DENSITY ||
+            _pMarchedLodGrid->cellSize > 1U)
+        {
+            return cubeOrigin + EDGE_MIDPOINT_OFFSETS[edgeIndex] * cellSize;
+        }
+
+        const glm::ivec3 cubeIndices(xIndex, yIndex, zIndex);
+        const glm::ivec3 cornerOffsetA = CUBE_CORNER_OFFSETS[EDGE_CORNER_INDICES[edgeIndex][0]];
+        const glm::ivec3 cornerOffsetB = CUBE_CORNER_OFFSETS[EDGE_CORNER_INDICES[edgeIndex][1]];
+
+        // Edges only cross the surface between a live and dead corner, 
+        // so the iso values always straddle the iso level
+        const float interpolationScalar = CalculateInterpolationScalar(GetCornerIsoValue(cubeIndices + cornerOffsetA),
+                                                                       GetCornerIsoValue(cubeIndices + cornerOffsetB),
+                                                                       DENSITY_ISO_LEVEL);
+
+        const glm::vec3 cornerPositionA = cubeOrigin + glm::vec3(cornerOffsetA.x, -cornerOffsetA.y, cornerOffsetA.z);
+        const glm::vec3 cornerPositionB = cubeOrigin + glm::vec3(cornerOffsetB.x, -cornerOffsetB.y, cornerOffsetB.z);
+
+        return glm::mix(cornerPositionA, 
+                        cornerPositionB, 
+                        interpolationScalar);
+    }
+
+    void MarchingCubesSystem::UpdateLiveNeighbourCounts()
+    {
+        const glm::uvec3 gridDimensions = _rSolGrid.GetDimensions();
+        const size_t     rowSize        = gridDimensions.x;
+        const size_t     sliceSize      = rowSize * gridDimensions.y;
+        const size_t     nodeCount      = sliceSize * gridDimensions.z;
+
+        _liveNeighbourCounts.resize(nodeCount);
+        _neighbourCountsScratch.resize(nodeCount);
+
+        // Sums each cell with its 2 neighbours along one axis, cells outside the grid count as dead
+        const auto SumAlongAxis = [&gridDimensions](const auto* pIn, 
+                                                    NeighbourCount_t* pOut, 
+                                                    const uint32_t axis, 
+                                                    const size_t stride)
+        {
+            size_t index(0U);
+
+            for (uint32_t zIndex(0U); zIndex < gridDimensions.z; ++zIndex)
+            {
+                for (uint32_t yIndex(0U); yIndex < gridDimensions.y; ++yIndex)
+                {
+                    for (uint32_t xIndex(0U); xIndex < gridDimensions.x; ++xIndex, ++index)
+                    {
+                        const uint32_t   axisIndex = glm::uvec3(xIndex, yIndex, zIndex)[axis];
+                        NeighbourCount_t sum       = pIn[index];
+
+                        if (axisIndex > 0U)
+                        {
+                            sum += pIn[index - stride];
+                        }
+
+                        if (axisIndex + 1U < gridDimensions[axis])
+                        {
+                            sum += pIn[index + stride];
+                        }
+
+                        pOut[index] = sum;
+                    }
+                }
+            }
+        };
+
+        // A 3x3x3 box sum is separable, so 3 passes of 3 rather than 1 pass of 27
+        SumAlongAxis(_rSolGrid.cells.pCellStates, _neighbourCountsScratch.data(), 0U, 1U);
+        SumAlongAxis(_neighbourCountsScratch.data(), _liveNeighbourCounts.data(), 1U, rowSize);
+        SumAlongAxis(_liveNeighbourCounts.data(), _neighbourCountsScratch.data(), 2U, sliceSize);
+
+        std::swap(_liveNeighbourCounts, _neighbourCountsScratch);
+    }
+
+    float MarchingCubesSystem::GetCornerIsoValue(const glm::ivec3& cellIndices) const
+    {
+        const int  index       = _3DTo1DIndex(cellIndices.x, cellIndices.y, cellIndices.z, _rSolGrid.GetDimensions());
+        const bool isCellAlive = _rSolGrid.cells.pCellStates[index];
 
-        return glm::vec3((pXVertices[indexA] + pXVertices[indexB]) * half,
-                         (pYVertices[indexA] + pYVertices[indexB]) * half, 
-                         (pZVertices[indexA] + pZVertices[indexB]) * half);
+        // Live cells are always above the iso level and dead cells below, so the surface 
+        // crosses the same edges as the Midpoint surface, but leans towards denser corners
+        return (isCellAlive ? DENSITY_ISO_LEVEL : 0.f) + 
+               (DENSITY_ISO_LEVEL * _liveNeighbourCounts.at(index) / MAX_LIVE_NEIGHBOUR_COUNT);
     }
 
     void MarchingCubesSystem::UpdateGameObjectModel()
@@ -193,6 +549,7 @@ namespace SolEngine::System
 
         std::shared_ptr<SolModel> pMarchingCubeModel = 
             std::make_shared<SolModel>(_rSolDevice, 
+                                       _rSolRenderer,
                                        _vertices.data(), 
                                        (uint32_t)_verticesInUseCount);
 
@@ -202,6 +559,59 @@ namespace SolEngine::System
             return;
         }
 
+        pMarchingCubeModel->SetChunks(_chunks);
+
+        // Frames still in flight may be drawing the previous model
+        _rSolRenderer.DeferRelease(_marchingCubesObject.GetModel());
         _marchingCubesObject.SetModel(pMarchingCubeModel);
     }
+
+    void MarchingCubesSystem::RetireGameObjectModel()
+    {
+        std::shared_ptr<SolModel> pRetiredModel = _marchingCubesObject.GetModel();
+
+        if (pRetiredModel == nullptr)
+        {
+            return;
+        }
+
+        // Every frame before the upcoming one may have drawn it
+        _retiredModels.push_back(RetiredModel
+        {
+            .pModel     = std::move(pRetiredModel),
+            .frameCount = _rSolRenderer.GetFrameNumber()
+        });
+    }
+
+    std::shared_ptr<SolModel> MarchingCubesSystem::AcquireMappedModel(const size_t minVertexCapacity)
+    {
+        const uint64_t completedFrameCount = _rSolRenderer.GetCompletedFrameCount();
+
+        // Finished with, but too small or far too big to be worth keeping
+        std::erase_if(_retiredModels, 
+                      [&](const RetiredModel& retiredModel) 
+                      { 
+                          const size_t vertexCapacity = retiredModel.pModel->GetVertexCapacity();
+
+                          return retiredModel.frameCount <= completedFrameCount &&
+                                 (vertexCapacity < minVertexCapacity || vertexCapacity > minVertexCapacity * 2U);
+                      });
+
+        const auto retiredModelIt = std::find_if(_retiredModels.begin(),
+                                                 _retiredModels.end(),
+                                                 [completedFrameCount](const RetiredModel& retiredModel) { return retiredModel.frameCount <= completedFrameCount; });
+
+        if (retiredModelIt != _retiredModels.end())
+        {
+            std::shared_ptr<SolModel> pModel = std::move(retiredModelIt->pModel);
+
+            _retiredModels.erase(retiredModelIt);
+
+            return pModel;
+        }
+
+        return std::make_shared<SolModel>(_rSolDevice, 
+                                          _rSolRenderer,
+                                          (uint32_t)minVertexCapacity);
+    }
 }
\ No newline at end of file
@@ -1,38 +1,147 @@
 #pragma once
+#include <array>
+#include <cfloat>
+
 #include "SolGrid.hpp"
 #include "SolGameObject.hpp"
+#include "SolRenderer.hpp"
+#include "MeshUploadStrategy.hpp"
+#include "RenderSettings.hpp"
 
 namespace SolEngine::System
 {
 	class MarchingCubesSystem
 	{
 	public:
-		MarchingCubesSystem(SolDevice& rSolDevice, SolGrid& rSolGrid, DiagnosticData& rDiagnosticData);
+		MarchingCubesSystem(SolDevice& rSolDevice, SolRenderer& rSolRenderer, SolGrid& rSolGrid, 
+							RenderSettings& rRenderSettings, DiagnosticData& rDiagnosticData);
 
-		SolGameObject& GetGameObject()					  { return _marchingCubesObject; }
-		size_t		   GetIsoValuesGeneratedCount() const { return _isoValuesGeneratedCount; }
+		SolGameObject&	   GetGameObject()					  { return _marchingCubesObject; }
+		size_t			   GetIsoValuesGeneratedCount() const { return _isoValuesGeneratedCount; }
+		MeshUploadStrategy GetUploadStrategy()			const { return _uploadStrategy; }
+		IsoSurfaceType	   GetIsoSurfaceType()			const { return _isoSurfaceType; }	// Of the last March
 
 		void March();
 		void ResetVerticesContainerSize() { _vertices.clear(); }
 
 	private:
-		uint32_t  GetCubeIndex(const bool* pNodeStates);
-		void	  GetCubeIsoValues(bool* pOutCubeIsoValues, const bool* pGridCellStates, 
-								   const int xIndex, const int yIndex, const int zIndex, 
-								   const glm::vec3& scaledGridDimensions);
-
-		void	  CreateVertices(Cells& rNodes, const Index_t* pEdgeIndices, const int xIndex, const int yIndex, const int zIndex);
-		glm::vec3 GetEdgeVertexPosition(Cells& rNodes, const int xIndex, const int yIndex, const int zIndex,
-										const std::pair<Index_t, Index_t>& cornerIndices);
+		static constexpr size_t	  MIN_MAPPED_VERTEX_CAPACITY{ 3U * 1024U };
+		static constexpr uint32_t CHUNK_CELLS_PER_AXIS		{ 16U };	// Cells per chunk along each axis
+		static constexpr uint32_t ROW_BLOCK_CUBE_COUNT		{ 32U };	// Cubes classified together when marching a row
+		static constexpr uint32_t CUBE_COLUMN_CORNER_COUNT	{ 4U };		// Corners sharing an x position
+		static constexpr uint32_t SIMD_BYTE_COUNT			{ 16U };
+		static constexpr uint32_t TRIANGLE_VERTEX_COUNT		{ 3U };
+		static constexpr float	  DENSITY_ISO_LEVEL			{ 0.5f };
+		static constexpr float	  MAX_LIVE_NEIGHBOUR_COUNT	{ CELL_NEIGHBOURS_COUNT_MOORE + 1U };	// Including the cell itself
+
+		/// <summary>
+		/// Maps a window of two corner columns (near column in the low nibble, bits ordered 
+		/// (y, z), (y, z + 1), (y + 1, z), (y + 1, z + 1)) to the TRI_TABLE cube index.
+		/// </summary>
+		static constexpr std::array<uint8_t, TRI_TABLE_COUNT> COLUMN_WINDOW_TO_CUBE_INDEX = []()
+		{
+			constexpr uint32_t nearCorners[CUBE_COLUMN_CORNER_COUNT]{ 0U, 3U, 4U, 7U };
+			constexpr uint32_t farCorners [CUBE_COLUMN_CORNER_COUNT]{ 1U, 2U, 5U, 6U };
+
+			std::array<uint8_t, TRI_TABLE_COUNT> cubeIndices{};
+
+			for (uint32_t columnWindow(0U); columnWindow < TRI_TABLE_COUNT; ++columnWindow)
+			{
+				uint32_t cubeIndex(0U);
+
+				for (uint32_t i(0U); i < CUBE_COLUMN_CORNER_COUNT; ++i)
+				{
+					cubeIndex |= ((columnWindow >> i) & 1U) << nearCorners[i];
+					cubeIndex |= ((columnWindow >> (i + CUBE_COLUMN_CORNER_COUNT)) & 1U) << farCorners[i];
+				}
+
+				cubeIndices[columnWindow] = (uint8_t)cubeIndex;
+			}
+
+			return cubeIndices;
+		}();
+
+		/// <summary>
+		/// The grid's cell states at one level of detail, each cell covering cellSize grid cells along each axis.
+		/// </summary>
+		struct LodGrid
+		{
+			const bool*				pCellStates	  { nullptr };
+			glm::uvec3				dimensions	  { 0U };
+			uint32_t				cellSize	  { 1U };
+			std::unique_ptr<bool[]> pOwnedStates  {};	// Downsampled levels only, the full resolution level is the grid's
+			size_t					ownedCapacity { 0U };
+		};
+
+		struct RetiredModel
+		{
+			std::shared_ptr<SolModel> pModel;
+			uint64_t				  frameCount;	// Safe to rewrite once this many frames have completed
+		};
+
+		void	  MarchGridCells();
+		void	  MarchIntoMappedModel();
+
+		/// <summary>
+		/// Downsamples the grid into each level of detail by majority, ties staying alive.
+		/// </summary>
+		void	  UpdateLodGrids();
+
+		/// <summary>
+		/// Marches the cubes of a level of detail covering the chunk's cells [minCellIndices, maxCellIndices).
+		/// </summary>
+		void	  MarchChunkLod(const LodGrid& lodGrid, const glm::uvec3& minCellIndices, const glm::uvec3& maxCellIndices);
+
+		/// <summary>
+		/// Marches the cubes in [minXIndex, maxXIndex) along a row, skipping empty and full cubes a block at a time.
+		/// </summary>
+		void			MarchRow(const uint32_t yIndex, const uint32_t zIndex, const uint32_t minXIndex, const uint32_t maxXIndex);
+		static uint64_t LoadColumnMask(const bool* pColumns, const uint32_t columnCount);
+
+		void	  CreateVertices(const Index_t* pEdgeIndices, const int xIndex, const int yIndex, const int zIndex);
+		void	  AddVertex(const Vertex& vertex);
+		glm::vec3 GetEdgeVertexPosition(const int xIndex, const int yIndex, const int zIndex, const Index_t edgeIndex);
+
+		/// <summary>
+		/// Counts the live cells in each cell's 3x3x3 block, for the Neighbour Density iso surface.
+		/// </summary>
+		void	  UpdateLiveNeighbourCounts();
+		float	  GetCornerIsoValue(const glm::ivec3& cellIndices) const;
 		void UpdateGameObjectModel();
+		void RetireGameObjectModel();
+
+		/// <summary>
+		/// Reuses a retired model the GPU has finished with, or creates one if none fit.
+		/// </summary>
+		std::shared_ptr<SolModel> AcquireMappedModel(const size_t minVertexCapacity);
 
 		SolDevice&		_rSolDevice;
+		SolRenderer&	_rSolRenderer;
 		SolGrid&		_rSolGrid;
+		RenderSettings& _rRenderSettings;
 		DiagnosticData& _rDiagnosticData;
 		SolGameObject	_marchingCubesObject;
 
+		MeshUploadStrategy	_uploadStrategy{ MeshUploadStrategy::STAGED };
+		IsoSurfaceType		_isoSurfaceType{ IsoSurfaceType::MIDPOINT };
+
+		std::vector<NeighbourCount_t> _liveNeighbourCounts	 {};	// Neighbour Density only
+		std::vector<NeighbourCount_t> _neighbourCountsScratch{};
+
+		std::array<LodGrid, MeshChunk::MAX_LOD_COUNT> _lodGrids		  {};
+		const LodGrid*								  _pMarchedLodGrid{ nullptr };	// Of the level being marched
+
 		size_t				_isoValuesGeneratedCount{ 0 };
 		size_t				_verticesInUseCount		{ 0U };
 		std::vector<Vertex> _vertices				{};
+
+		std::vector<MeshChunk> _chunks		  {};
+		glm::vec3			   _chunkMinBounds{ 0.f };	// Of the chunk being marched
+		glm::vec3			   _chunkMaxBounds{ 0.f };
+
+		// Direct Write only
+		Vertex*					  _pMappedVertices		{ nullptr };
+		size_t					  _mappedVertexCapacity	{ 0U };
+		std::vector<RetiredModel> _retiredModels		{};
 	};
 }
\ No newline at end of file
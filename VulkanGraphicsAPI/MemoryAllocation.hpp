@@ -0,0 +1,18 @@
+#pragma once
+#include <vulkan/vulkan.hpp>
+
+namespace SolEngine::Data
+{
+    /// <summary>
+    /// A range of a VkDeviceMemory handed out by SolMemoryAllocator.
+    /// </summary>
+    struct MemoryAllocation
+    {
+        VkDeviceMemory memory     { VK_NULL_HANDLE };
+        VkDeviceSize   offset     { 0 };
+        VkDeviceSize   size       { 0 };            // Size of the buddy block, at least the requested size
+        void*          pMappedData{ nullptr };      // Already offset, only set for host visible memory
+        uint32_t       poolIndex  { 0 };
+        uint32_t       order      { 0 };            // Buddy order, DEDICATED_ORDER when it owns the memory outright
+    };
+}
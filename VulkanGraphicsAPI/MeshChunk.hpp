@@ -0,0 +1,20 @@
+#pragma once
+#include <glm/glm.hpp>
+
+namespace SolEngine::Data
+{
+    /// <summary>
+    /// Contiguous ranges of a model's vertices, meshed from one block of grid cells.
+    /// Each level of detail meshes the block with half the cells per axis of the level before it.
+    /// </summary>
+    struct MeshChunk
+    {
+        static constexpr uint32_t MAX_LOD_COUNT{ 3U };
+
+        uint32_t  firstVertices[MAX_LOD_COUNT]{};
+        uint32_t  vertexCounts [MAX_LOD_COUNT]{};
+        uint32_t  lodCount     { 1U };
+        glm::vec3 minBounds    { 0.f };   // Bounding box of every level's vertices, in model space
+        glm::vec3 maxBounds    { 0.f };
+    };
+}
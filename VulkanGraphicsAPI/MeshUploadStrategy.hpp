@@ -0,0 +1,11 @@
+#pragma once
+
+namespace SolEngine::Enumeration
+{
+	enum class MeshUploadStrategy
+	{
+		UNKNOWN = -1,
+		STAGED,			// Copied from a Staging Buffer into Device Local Memory at the start of the frame
+		DIRECT_WRITE	// Written straight into mapped Device Local Memory (Unified Memory / ReBAR)
+	};
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace SolEngine::Enumeration
+{
+	enum class MeshingAlgorithm
+	{
+		UNKNOWN = -1,
+		MARCHING_CUBES,		// Surface between live and dead cells, see IsoSurfaceType
+		GREEDY_VOXELS,		// Exposed live cell faces, coplanar faces merged into as few quads as possible
+		MARCHING_CUBES_GPU,	// Marching Cubes' midpoint surface, meshed by a compute shader and drawn indirectly
+		INSTANCED_CUBES,	// A cube per live cell, drawn as instances of one indexed cube rather than meshed
+		COUNT
+	};
+}
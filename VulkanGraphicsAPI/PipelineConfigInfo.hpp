@@ -18,5 +18,9 @@ namespace SolEngine::Data
         VkPipelineLayout                       pipelineLayout{NULL};
         VkRenderPass                           renderPass{NULL};
         uint32_t                               subpass{0};
+
+        // Vertex's bindings by default, add to them for per-instance data
+        std::vector<VkVertexInputBindingDescription>   inputBindingDescriptions{};
+        std::vector<VkVertexInputAttributeDescription> inputAttributeDescriptions{};
     };
 }
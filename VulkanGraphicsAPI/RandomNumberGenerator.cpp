@@ -4,16 +4,120 @@ namespace Utility
 {
 	unsigned int RandomNumberGenerator::_seed{ 0U };
 
-	bool RandomNumberGenerator::GetRandomBool()
+	void RandomNumberGenerator::FillRandomBools(bool* pOutValues, 
+												const size_t count, 
+												const float trueProbability)
 	{
-		const bool value = rand() % 2;
+		const float	   clampedProbability = std::clamp(trueProbability, 0.f, 1.f);
+		const uint32_t scaledProbability  = (uint32_t)std::lround(clampedProbability * PROBABILITY_SCALE);
+		const size_t   chunkCount		  = (count + VALUES_PER_CHUNK - 1) / VALUES_PER_CHUNK;
 
-		return value;
+		std::vector<size_t> chunkIndices(chunkCount);
+		std::iota(chunkIndices.begin(), chunkIndices.end(), 0U);
+
+		std::for_each(std::execution::par, 
+					  chunkIndices.begin(), 
+					  chunkIndices.end(), 
+					  [&](const size_t chunkIndex)
+					  {
+						  const size_t firstValueIndex = chunkIndex * VALUES_PER_CHUNK;
+						  const size_t chunkValueCount = std::min(VALUES_PER_CHUNK, count - firstValueIndex);
+
+						  FillRandomBoolsChunk(pOutValues + firstValueIndex, 
+											   chunkValueCount, 
+											   chunkIndex, 
+											   scaledProbability);
+					  });
 	}
 
 	void RandomNumberGenerator::SetSeed(const unsigned int seed)
 	{ 
 		_seed = seed;
-		srand(seed);
 	}
-}
\ No newline at end of file
+
+	RandomNumberGenerator::Xoshiro256StarStar::Xoshiro256StarStar(uint64_t seed)
+	{
+		// Expand the seed with SplitMix64 as recommended, so the state is never all zeros
+		for (uint64_t& rState : state)
+		{
+			rState = SplitMix64(seed);
+		}
+	}
+
+	uint64_t RandomNumberGenerator::Xoshiro256StarStar::Next()
+	{
+		const auto RotateLeft = [](const uint64_t x, const int k) { return (x << k) | (x >> (64 - k)); };
+
+		const uint64_t result = RotateLeft(state[1] * 5, 7) * 9;
+		const uint64_t t	  = state[1] << 17;
+
+		state[2] ^= state[0];
+		state[3] ^= state[1];
+		state[1] ^= state[2];
+		state[0] ^= state[3];
+		state[2] ^= t;
+		state[3]  = RotateLeft(state[3], 45);
+
+		return result;
+	}
+
+	uint64_t RandomNumberGenerator::SplitMix64(uint64_t& rState)
+	{
+		uint64_t z = (rState += 0x9E3779B97F4A7C15ULL);
+
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+		return z ^ (z >> 31);
+	}
+
+	uint64_t RandomNumberGenerator::NextBernoulliBits(Xoshiro256StarStar& rGenerator, 
+													  const uint32_t scaledProbability)
+	{
+		if (scaledProbability == 0U)
+		{
+			return 0ULL;
+		}
+
+		if (scaledProbability >= PROBABILITY_SCALE)
+		{
+			return ~0ULL;
+		}
+
+		// Each bit of the probability (least significant first) either ORs or ANDs in a fresh
+		// draw, halving the chance of a bit being set and adding half when the bit is set.
+		// All 64 bits end up set with probability scaledProbability / 256, e.g. 50% is a single draw.
+		uint64_t bits(0ULL);
+
+		for (uint32_t i = std::countr_zero(scaledProbability); i < PROBABILITY_BITS; ++i)
+		{
+			const uint64_t draw = rGenerator.Next();
+
+			bits = (scaledProbability & (1U << i)) ? (bits | draw) : (bits & draw);
+		}
+
+		return bits;
+	}
+
+	void RandomNumberGenerator::FillRandomBoolsChunk(bool* pOutValues, 
+													 const size_t count, 
+													 const size_t chunkIndex, 
+													 const uint32_t scaledProbability)
+	{
+		// Every chunk gets its own stream derived from the seed and its position, 
+		// so chunks can be filled in any order on any thread
+		uint64_t		   chunkSeed = ((uint64_t)_seed << 32) ^ chunkIndex;
+		Xoshiro256StarStar generator(SplitMix64(chunkSeed));
+
+		for (size_t i = 0; i < count; i += VALUES_PER_DRAW)
+		{
+			const uint64_t bits	  = NextBernoulliBits(generator, scaledProbability);
+			const size_t   length = std::min(VALUES_PER_DRAW, count - i);
+
+			for (size_t bit = 0; bit < length; ++bit)
+			{
+				pOutValues[i + bit] = (bits >> bit) & 1ULL;
+			}
+		}
+	}
+}
@@ -1,15 +1,47 @@
 #pragma once
-#include <random>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <execution>
+#include <numeric>
+#include <vector>
 
 namespace Utility
 {
 	class RandomNumberGenerator
 	{
 	public:
-		static bool GetRandomBool();
+		/// <summary>
+		/// Fills an array with random bools, each being true with the given probability (quantised to 1/256).
+		/// The array is split into independently seeded chunks which are filled in parallel, 
+		/// results only depend on the seed - never on the platform or how many threads were used.
+		/// </summary>
+		static void FillRandomBools(bool* pOutValues, const size_t count, const float trueProbability);
 
 		static void SetSeed(const unsigned int seed);
 	private:
+		static constexpr size_t   VALUES_PER_CHUNK  { 1 << 16 };	// Values generated by each independently seeded stream
+		static constexpr size_t   VALUES_PER_DRAW   { 64U };		// One bit per value from each 64-bit draw
+		static constexpr uint32_t PROBABILITY_BITS  { 8U };			// Probability resolution of 1/256
+		static constexpr uint32_t PROBABILITY_SCALE { 1U << PROBABILITY_BITS };
+
+		/// <summary>
+		/// xoshiro256** - https://prng.di.unimi.it/
+		/// </summary>
+		struct Xoshiro256StarStar
+		{
+			Xoshiro256StarStar(uint64_t seed);
+
+			uint64_t Next();
+
+			uint64_t state[4];
+		};
+
+		static uint64_t SplitMix64(uint64_t& rState);
+		static uint64_t NextBernoulliBits(Xoshiro256StarStar& rGenerator, const uint32_t scaledProbability);
+		static void     FillRandomBoolsChunk(bool* pOutValues, const size_t count, const size_t chunkIndex, const uint32_t scaledProbability);
+
 		static unsigned int _seed;
 	};
 }
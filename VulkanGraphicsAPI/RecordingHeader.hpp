@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+
+namespace SolEngine::Data
+{
+	/// <summary>
+	/// Start of a recording file. It is followed by one frame per recorded generation, each being a 
+	/// RecordingFrameHeader and its compressed bytes. Keyframes hold the bit-packed cell states, 
+	/// every other frame holds the states XOR'd against the previous generation.
+	/// </summary>
+	struct RecordingHeader
+	{
+		static constexpr uint32_t MAGIC  { 0x43524C53 };	// "SLRC"
+		static constexpr uint32_t VERSION{ 1U };
+
+		uint32_t magic	 { MAGIC };
+		uint32_t version { VERSION };
+
+		uint32_t dimensions[3]	 { 0U };
+		uint32_t keyframeInterval{ 0U };
+		uint64_t cellCount		 { 0U };
+		uint64_t firstGeneration { 0U };
+	};
+
+	struct RecordingFrameHeader
+	{
+		uint64_t generation			{ 0U };
+		uint32_t compressedSizeBytes{ 0U };
+		uint32_t isKeyframe			{ 0U };
+	};
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+
+namespace SolEngine::Settings
+{
+	struct RecordingSettings
+	{
+		void ResetKeyframeInterval()
+		{
+			RecordingSettings defaultSettings{};
+
+			keyframeInterval = defaultSettings.keyframeInterval;
+		}
+
+		bool isRecordingToggleRequested{ false };
+		bool isPlaybackToggleRequested { false };
+		bool isPlaybackSeekRequested   { false };
+
+		bool isRecording	  { false };	// Set once the recorder has actually opened its file
+		bool isPlaybackEnabled{ false };	// Set once a recording has been opened, the simulation is frozen whilst enabled
+
+		uint32_t keyframeInterval		{ 64U };	// Generations between full snapshots. Shorter intervals seek faster but take more space
+		size_t	 firstRecordedGeneration{ 0U };
+		size_t	 lastRecordedGeneration { 0U };
+		size_t	 playbackGeneration		{ 0U };
+	};
+}
@@ -1,12 +1,20 @@
 #pragma once
 #include <vulkan/vulkan.hpp>
 
+#include "IsoSurfaceType.hpp"
+#include "MeshingAlgorithm.hpp"
+
+using namespace SolEngine::Enumeration;
+
 namespace SolEngine::Settings
 {
     struct RenderSettings
     {
-        bool               isRendererOutOfDate{ true };
-        VkPolygonMode      polygonMode        { VK_POLYGON_MODE_LINE };
-        VkCullModeFlagBits cullMode           { VK_CULL_MODE_BACK_BIT };
+        VkPolygonMode      polygonMode{ VK_POLYGON_MODE_LINE };
+        VkCullModeFlagBits cullMode   { VK_CULL_MODE_BACK_BIT };
+        uint32_t           framesInFlight{ 2 };  // How far the CPU can run ahead of the GPU
+        IsoSurfaceType     isoSurfaceType{ IsoSurfaceType::MIDPOINT };
+        MeshingAlgorithm   meshingAlgorithm{ MeshingAlgorithm::MARCHING_CUBES };
+        bool               isLightingEnabled{ false };
     };
 }
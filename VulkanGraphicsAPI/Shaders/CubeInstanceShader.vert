@@ -0,0 +1,37 @@
+#version 450
+
+// Vertex Attributes, of the unit cube
+layout(location = 0) in vec3 position;      // Relative to cell (0, 0, 0)'s centre
+layout(location = 2) in vec3 normal;
+
+// Instance Attributes, of the live cell
+layout(location = 3) in uvec3 cellIndices;
+
+layout(location = 0) out vec3 fragColour;
+
+layout(push_constant) uniform Push
+{
+    mat4 transform;
+    vec3 colour;            // Scales the cell's indices into its colour, one over the grid dimensions
+    vec3 lightDirection;    // Model space, towards the light
+} push;
+
+const float AMBIENT   = 0.25;
+const float CELL_SIZE = 256.0 / 32767.0;    // Vertex::POSITION_QUANTISATION, in the SNORM16 units the cube arrives in
+
+// The grid's y-axis runs downwards
+const vec3 GRID_TO_MODEL_SPACE = vec3(1.0, -1.0, 1.0);
+
+void main()
+{
+    vec3 cellPosition = vec3(cellIndices);
+
+    // Offset in the same units as the cube, so the transform dequantises both
+    gl_Position = push.transform * vec4(position + cellPosition * GRID_TO_MODEL_SPACE * CELL_SIZE, 1.0);
+
+    // Always lit, otherwise neighbouring cubes of a similar colour blend into one.
+    // Shares SimpleShader.frag, which just outputs the colour.
+    // Coloured by grid position, the same as the meshes
+    float diffuse = max(dot(normalize(normal), push.lightDirection), 0.0);
+    fragColour = cellPosition * push.colour * (AMBIENT + (1.0 - AMBIENT) * diffuse);
+}
@@ -0,0 +1,27 @@
+#version 450
+
+// Vertex Attributes
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec3 colour;
+layout(location = 2) in vec3 normal;
+
+layout(location = 0) out vec3 fragColour;
+
+layout(push_constant) uniform Push
+{
+    mat4 transform;
+    vec3 colour;
+    vec3 lightDirection;    // Model space, towards the light
+} push;
+
+const float AMBIENT = 0.25;
+
+void main()
+{
+    gl_Position = push.transform * vec4(position, 1.0);
+
+    // Lit per vertex, normals are flat across each triangle anyway.
+    // Shares SimpleShader.frag, which just outputs the colour
+    float diffuse = max(dot(normalize(normal), push.lightDirection), 0.0);
+    fragColour = colour * (AMBIENT + (1.0 - AMBIENT) * diffuse);
+}
\ No newline at end of file
@@ -8,5 +8,6 @@ namespace SolEngine::Data
 	{
 		glm::mat4 transform{ 1.0f };
 		alignas(16) glm::vec3 colour;
+		alignas(16) glm::vec3 lightDirection{ 0.f };	// Model space, LitShader only
 	};
 }
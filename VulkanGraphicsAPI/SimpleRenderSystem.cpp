@@ -1,11 +1,16 @@
+#include <algorithm>
+#include <cmath>
+
 #include "SimpleRenderSystem.hpp"
 
 namespace SolEngine::Rendering
 {
     SimpleRenderSystem::SimpleRenderSystem(SolDevice& rSolDevice, 
+                                           SolShaderLibrary& rSolShaderLibrary,
                                            RenderSettings& rRenderSettings,
                                            VkRenderPass renderPass)
         : GenericRenderSystem(rSolDevice, 
+                              rSolShaderLibrary,
                               rRenderSettings,
                               renderPass)
     {}
@@ -20,58 +25,284 @@ namespace SolEngine::Rendering
             return;
         }
 
+        BindPipeline(commandBuffer);
+
+        DrawGameObject(commandBuffer, 
+                       solCamera.GetProjectionViewMatrix(), 
+                       gameObject);
+    }
+
+    void SimpleRenderSystem::RenderGameObjects(const SolCamera &solCamera,
+                                               const VkCommandBuffer commandBuffer, 
+                                               const std::vector<SolGameObject> &gameObjects) const
+    {
         const glm::mat4 projectionView = solCamera.GetProjectionViewMatrix();
 
-        _pSolPipeline->Bind(commandBuffer);
+        BindPipeline(commandBuffer);
 
+        for (const SolGameObject& gameObject : gameObjects)
+        {
+            DrawGameObject(commandBuffer, 
+                           projectionView, 
+                           gameObject);
+        }
+    }
+
+    std::vector<VkCommandBuffer> SimpleRenderSystem::RecordChunkedGameObject(const SolCamera& solCamera, 
+                                                                             SolRenderer& rSolRenderer, 
+                                                                             const SolGameObject& gameObject,
+                                                                             DiagnosticData& rDiagnosticData) const
+    {
         const std::shared_ptr<SolModel>& pGameObjectModel = gameObject.GetModel();
+        const glm::mat4                  projectionView   = solCamera.GetProjectionViewMatrix();
 
-        const SimplePushConstantData pushConstantData
+        if (pGameObjectModel == nullptr ||
+            pGameObjectModel->GetChunks().empty())
         {
-            .transform = projectionView * gameObject.transform.TransformMatrix(),
-            .colour    = gameObject.GetColour()
+            // Nothing to split up, draw it whole
+            rDiagnosticData.chunkCount          = 0U;
+            rDiagnosticData.culledChunkCount    = 0U;
+            rDiagnosticData.drawnVertexCount    = (pGameObjectModel != nullptr) ? rDiagnosticData.vertexCount 
+                                                                                : 0U;
+            rDiagnosticData.lowDetailChunkCount = 0U;
+
+            const VkCommandBuffer commandBuffer = rSolRenderer.BeginSecondaryCommandBuffer(0);
+
+            BindPipeline(commandBuffer);
+            DrawGameObject(commandBuffer, 
+                           projectionView, 
+                           gameObject);
+
+            rSolRenderer.EndSecondaryCommandBuffer(commandBuffer);
+
+            return { commandBuffer };
+        }
+
+        const std::vector<MeshChunk>& chunks = pGameObjectModel->GetChunks();
+
+        const size_t chunkCount      = chunks.size();
+        const size_t maxThreadCount  = (std::min)(static_cast<size_t>(SolRenderer::MAX_RECORDING_THREADS), 
+                                                  static_cast<size_t>((std::max)(std::thread::hardware_concurrency(), 1U)));
+        const size_t threadCount     = std::clamp((chunkCount + MIN_CHUNKS_PER_THREAD - 1) / MIN_CHUNKS_PER_THREAD, 
+                                                  size_t(1), 
+                                                  maxThreadCount);
+        const size_t chunksPerThread = (chunkCount + threadCount - 1) / threadCount;
+
+        // Chunk bounds are in model space, so cull against the full Model-View-Projection
+        const glm::mat4 modelMatrix         = gameObject.transform.TransformMatrix();
+        const glm::mat4 modelViewProjection = projectionView * modelMatrix;
+        const Frustum   frustum(modelViewProjection);
+
+        // Pixels covered by a model space unit one unit of depth away, scaled by the model's y-axis
+        const float pixelsPerModelUnit = glm::length(glm::vec3(modelMatrix[1])) *
+                                         solCamera.GetProjectionMatrix()[1][1] *
+                                         rSolRenderer.GetExtentDimensions().y * 0.5f;
+
+        // Each thread writes the draw commands for its share of the chunks into its own slice
+        const StagingAllocation drawCommands = rSolRenderer.AllocateStagingMemory(chunkCount * sizeof(VkDrawIndirectCommand));
+
+        // Wait for the pipeline here, so the workers only have to bind it
+        SolPipeline& rPipelineVariant = GetPipelineVariant();
+
+        std::vector<VkCommandBuffer> secondaryCommandBuffers(threadCount);
+        std::vector<size_t>          drawnVertexCounts(threadCount, 0U);
+        std::vector<size_t>          culledChunkCounts(threadCount, 0U);
+        std::vector<size_t>          lowDetailChunkCounts(threadCount, 0U);
+
+        const auto recordChunks = [&](const uint32_t threadIndex)
+        {
+            const size_t firstChunkIndex = threadIndex * chunksPerThread;
+            const size_t endChunkIndex   = (std::min)(firstChunkIndex + chunksPerThread, chunkCount);
+
+            VkDrawIndirectCommand* pDrawCommands = static_cast<VkDrawIndirectCommand*>(drawCommands.pMappedData) + firstChunkIndex;
+            uint32_t               drawCount(0);
+
+            for (size_t i(firstChunkIndex); i < endChunkIndex; ++i)
+            {
+                const MeshChunk& chunk = chunks.at(i);
+
+                if (!frustum.IsBoxVisible(chunk.minBounds, chunk.maxBounds))
+                {
+                    ++culledChunkCounts.at(threadIndex);
+                    continue;
+                }
+
+                const uint32_t lod = SelectChunkLod(chunk, 
+                                                    modelViewProjection, 
+                                                    pixelsPerModelUnit);
+
+                lowDetailChunkCounts.at(threadIndex) += (lod > 0U);
+
+                // A level can mesh to nothing, even when the others don't
+                if (chunk.vertexCounts[lod] == 0U)
+                {
+                    continue;
+                }
+
+                drawnVertexCounts.at(threadIndex) += chunk.vertexCounts[lod];
+
+                pDrawCommands[drawCount++] = VkDrawIndirectCommand
+                {
+                    .vertexCount   = chunk.vertexCounts[lod],
+                    .instanceCount = 1,
+                    .firstVertex   = chunk.firstVertices[lod],
+                    .firstInstance = 0
+                };
+            }
+
+            const VkCommandBuffer commandBuffer = rSolRenderer.BeginSecondaryCommandBuffer(threadIndex);
+
+            BindPipeline(commandBuffer, rPipelineVariant);
+
+            // Every chunk shares the game object's transform
+            PushConstants(commandBuffer, 
+                          projectionView, 
+                          gameObject);
+
+            pGameObjectModel->Bind(commandBuffer);
+            pGameObjectModel->DrawIndirect(commandBuffer, 
+                                           drawCommands.buffer, 
+                                           drawCommands.offset + firstChunkIndex * sizeof(VkDrawIndirectCommand), 
+                                           drawCount);
+
+            rSolRenderer.EndSecondaryCommandBuffer(commandBuffer);
+
+            secondaryCommandBuffers.at(threadIndex) = commandBuffer;
         };
 
-        vkCmdPushConstants(commandBuffer,
-                           _pipelineLayout,
-                           VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
-                           0,
-                           sizeof(SimplePushConstantData),
-                           &pushConstantData);
+        std::vector<std::future<void>> workers{};
+
+        for (uint32_t threadIndex(1); threadIndex < threadCount; ++threadIndex)
+        {
+            workers.push_back(std::async(std::launch::async, 
+                                         recordChunks, 
+                                         threadIndex));
+        }
+
+        // The main thread culls the first share rather than sitting idle
+        recordChunks(0);
 
+        for (std::future<void>& rWorker : workers)
+        {
+            rWorker.wait();
+        }
+
+        rDiagnosticData.chunkCount          = chunkCount;
+        rDiagnosticData.culledChunkCount    = 0U;
+        rDiagnosticData.drawnVertexCount    = 0U;
+        rDiagnosticData.lowDetailChunkCount = 0U;
+
+        for (size_t threadIndex(0); threadIndex < threadCount; ++threadIndex)
+        {
+            rDiagnosticData.culledChunkCount    += culledChunkCounts.at(threadIndex);
+            rDiagnosticData.drawnVertexCount    += drawnVertexCounts.at(threadIndex);
+            rDiagnosticData.lowDetailChunkCount += lowDetailChunkCounts.at(threadIndex);
+        }
+
+        return secondaryCommandBuffers;
+    }
+
+    VkCommandBuffer SimpleRenderSystem::RecordIndirectGameObject(const SolCamera& solCamera, 
+                                                                 SolRenderer& rSolRenderer, 
+                                                                 const SolGameObject& gameObject,
+                                                                 const VkBuffer drawCommandBuffer,
+                                                                 DiagnosticData& rDiagnosticData) const
+    {
+        const VkCommandBuffer commandBuffer = rSolRenderer.BeginSecondaryCommandBuffer(0);
+
+        const std::shared_ptr<SolModel>& pGameObjectModel = gameObject.GetModel();
+
+        // The vertex count is left to whatever wrote the draw command, only it can read it back
+        rDiagnosticData.chunkCount          = 0U;
+        rDiagnosticData.culledChunkCount    = 0U;
+        rDiagnosticData.lowDetailChunkCount = 0U;
+
+        if (pGameObjectModel == nullptr)
+        {
+            // No model to bind/draw
+            rSolRenderer.EndSecondaryCommandBuffer(commandBuffer);
+
+            return commandBuffer;
+        }
+
+        BindPipeline(commandBuffer);
+
+        PushConstants(commandBuffer, 
+                      solCamera.GetProjectionViewMatrix(), 
+                      gameObject);
 
         pGameObjectModel->Bind(commandBuffer);
-        pGameObjectModel->Draw(commandBuffer);
+        pGameObjectModel->DrawIndirect(commandBuffer, 
+                                       drawCommandBuffer, 
+                                       0, 
+                                       1);
+
+        rSolRenderer.EndSecondaryCommandBuffer(commandBuffer);
+
+        return commandBuffer;
     }
 
-    void SimpleRenderSystem::RenderGameObjects(const SolCamera &solCamera,
-                                               const VkCommandBuffer commandBuffer, 
-                                               const std::vector<SolGameObject> &gameObjects) const
+    uint32_t SimpleRenderSystem::SelectChunkLod(const MeshChunk& chunk, 
+                                                const glm::mat4& modelViewProjection, 
+                                                const float pixelsPerModelUnit)
     {
-        const glm::mat4 projectionView = solCamera.GetProjectionViewMatrix();
+        const glm::vec3 chunkCentre = (chunk.minBounds + chunk.maxBounds) * 0.5f;
 
-        _pSolPipeline->Bind(commandBuffer);
+        // The projection copies view space depth into w
+        const float depth = (modelViewProjection * glm::vec4(chunkCentre, 1.f)).w;
 
-        for (const SolGameObject& gameObject : gameObjects)
+        if (chunk.lodCount <= 1U ||
+            depth <= 0.f)
         {
-            const std::shared_ptr<SolModel>& pGameObjectModel = gameObject.GetModel();
+            return 0U;
+        }
 
-            const SimplePushConstantData pushConstantData
-            {
-                .transform = projectionView * gameObject.transform.TransformMatrix(),
-                .colour    = gameObject.GetColour()
-            };
+        // Each level doubles the cell size, so go up a level for every halving of the full resolution cell's pixels
+        const float pixelsPerCell = pixelsPerModelUnit / depth;
+        const float lod           = std::ceil(std::log2(MIN_PIXELS_PER_CELL / pixelsPerCell));
 
-            vkCmdPushConstants(commandBuffer,
-                               _pipelineLayout,
-                               VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
-                               0,
-                               sizeof(SimplePushConstantData),
-                               &pushConstantData);
+        return (uint32_t)std::clamp(lod, 0.f, (float)(chunk.lodCount - 1U));
+    }
 
+    void SimpleRenderSystem::DrawGameObject(const VkCommandBuffer commandBuffer, 
+                                            const glm::mat4& projectionView, 
+                                            const SolGameObject& gameObject) const
+    {
+        const std::shared_ptr<SolModel>& pGameObjectModel = gameObject.GetModel();
 
-            pGameObjectModel->Bind(commandBuffer);
-            pGameObjectModel->Draw(commandBuffer);
+        if (pGameObjectModel == nullptr)
+        {
+            // No model to bind/draw
+            return;
         }
+
+        PushConstants(commandBuffer, 
+                      projectionView, 
+                      gameObject);
+
+        pGameObjectModel->Bind(commandBuffer);
+        pGameObjectModel->Draw(commandBuffer);
+    }
+
+    void SimpleRenderSystem::PushConstants(const VkCommandBuffer commandBuffer, 
+                                           const glm::mat4& projectionView, 
+                                           const SolGameObject& gameObject) const
+    {
+        const glm::mat4 modelMatrix = gameObject.transform.TransformMatrix();
+
+        // Normals stay in model space, so bring the light to them once per draw instead
+        const SimplePushConstantData pushConstantData
+        {
+            .transform      = projectionView * modelMatrix * Vertex::PositionDequantisationMatrix(),
+            .colour         = gameObject.GetColour(),
+            .lightDirection = glm::normalize(glm::inverse(glm::mat3(modelMatrix)) * LIGHT_DIRECTION)
+        };
+
+        vkCmdPushConstants(commandBuffer,
+                           _pipelineLayout,
+                           VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                           0,
+                           sizeof(SimplePushConstantData),
+                           &pushConstantData);
     }
 }
\ No newline at end of file
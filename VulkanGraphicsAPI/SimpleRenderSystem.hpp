@@ -1,5 +1,10 @@
 #pragma once
+#include <thread>
+
 #include "GenericRenderSystem.hpp"
+#include "SolRenderer.hpp"
+#include "Frustum.hpp"
+#include "DiagnosticData.hpp"
 
 namespace SolEngine::Rendering
 {
@@ -7,9 +12,38 @@ namespace SolEngine::Rendering
     {
     public:
         SimpleRenderSystem() = delete;
-        SimpleRenderSystem(SolDevice& rSolDevice, RenderSettings& rRenderSettings, VkRenderPass renderPass);
+        SimpleRenderSystem(SolDevice& rSolDevice, SolShaderLibrary& rSolShaderLibrary, RenderSettings& rRenderSettings, VkRenderPass renderPass);
 
         void RenderGameObject(const SolCamera& solCamera, const VkCommandBuffer commandBuffer, const SolGameObject& gameObject) const;
         void RenderGameObjects(const SolCamera& solCamera, const VkCommandBuffer commandBuffer, const std::vector<SolGameObject>& gameObjects) const;
+
+        /// <summary>
+        /// Draws every chunk of the game object's model inside the camera's frustum with indirect draws, recorded into secondary command buffers.
+        /// The chunks are split between threads, each culling its share and writing the draw commands into its own slice of the frame's staging memory,
+        /// so neither the number of draw calls nor the main thread's work grows with the chunk count.
+        /// Each chunk draws the coarsest level of detail whose cells still cover MIN_PIXELS_PER_CELL on screen.
+        /// </summary>
+        /// <returns>The secondary command buffers in draw order, for SolRenderer::ExecuteSecondaryCommandBuffers.</returns>
+        std::vector<VkCommandBuffer> RecordChunkedGameObject(const SolCamera& solCamera, SolRenderer& rSolRenderer, const SolGameObject& gameObject, DiagnosticData& rDiagnosticData) const;
+
+        /// <summary>
+        /// Draws the game object's model with a VkDrawIndirectCommand the GPU wrote into drawCommandBuffer, recorded into a secondary command buffer.
+        /// Nothing is culled, as the CPU doesn't know what was written.
+        /// </summary>
+        VkCommandBuffer RecordIndirectGameObject(const SolCamera& solCamera, SolRenderer& rSolRenderer, const SolGameObject& gameObject, 
+                                                 const VkBuffer drawCommandBuffer, DiagnosticData& rDiagnosticData) const;
+
+    private:
+        static constexpr size_t    MIN_CHUNKS_PER_THREAD{ 64U };                 // Fewer aren't worth culling on another thread
+        static constexpr glm::vec3 LIGHT_DIRECTION      { -0.4f, -1.f, 0.6f };   // World space, towards the light (Above and in front, up is -y)
+        static constexpr float     MIN_PIXELS_PER_CELL  { 4.f };                 // Coarser cells would be too small to make out
+
+        /// <summary>
+        /// Picks the chunk's level of detail from how many pixels its full resolution cells cover, at the chunk's centre.
+        /// </summary>
+        static uint32_t SelectChunkLod(const MeshChunk& chunk, const glm::mat4& modelViewProjection, const float pixelsPerModelUnit);
+
+        void DrawGameObject(const VkCommandBuffer commandBuffer, const glm::mat4& projectionView, const SolGameObject& gameObject) const;
+        void PushConstants(const VkCommandBuffer commandBuffer, const glm::mat4& projectionView, const SolGameObject& gameObject) const;
     };
 }
@@ -0,0 +1,12 @@
+#pragma once
+
+namespace SolEngine::Enumeration
+{
+	enum class SimulationBackend
+	{
+		UNKNOWN = -1,
+		CPU,			// Stepped a row at a time on the main thread
+		GPU_COMPUTE,	// Stepped by a compute shader, the cells are only read back once per batch of generations
+		COUNT
+	};
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "SolEvent.hpp"
 #include "SimulationState.hpp"
+#include "SimulationBackend.hpp"
 
 using namespace SolEngine::Enumeration;
 using namespace SolEngine::Events;
@@ -31,12 +32,17 @@ namespace SolEngine::Settings
 		bool IsSimulationPlaying() const { return state == SimulationState::PLAY; }
 
 		SolEvent<float> onSimulationSpeedChangedEvent;
+		SolEvent<>		onSimulationRestoredEvent;	// Settings have been overwritten by a checkpoint or recording, refresh any cached copies
 
 		bool isSimulationResetRequested{ false };
-
-		int				seed	  { 0 };
-		size_t			generation{ 0U };
-		float			speed	  { 0.1f };
-		SimulationState state	  { SimulationState::PAUSED };
+		bool isCheckpointSaveRequested { false };
+		bool isCheckpointLoadRequested { false };
+		bool isFastForwardEnabled	   { false };	// Step as many generations as the frame budget allows, ignoring speed
+
+		int				  seed		{ 0 };
+		size_t			  generation{ 0U };
+		float			  speed		{ 0.1f };
+		SimulationState	  state		{ SimulationState::PAUSED };
+		SimulationBackend backend	{ SimulationBackend::CPU };	// GPU_COMPUTE falls back to CPU if its shader is missing
 	};
 }
\ No newline at end of file
@@ -8,20 +8,34 @@ namespace SolEngine
                          const VkBufferUsageFlags usageFlags, 
                          const VkMemoryPropertyFlags memPropertyFlags, 
                          const VkDeviceSize minOffsetAlignment)
+        : SolBuffer(rDevice, 
+                    instanceSize, 
+                    instanceCount, 
+                    usageFlags, 
+                    std::vector<VkMemoryPropertyFlags>{ memPropertyFlags }, 
+                    minOffsetAlignment)
+    {}
+
+    SolBuffer::SolBuffer(SolDevice& rDevice, 
+                         const VkDeviceSize& instanceSize,
+                         const uint32_t instanceCount, 
+                         const VkBufferUsageFlags usageFlags, 
+                         const std::vector<VkMemoryPropertyFlags>& preferredMemPropertyFlags, 
+                         const VkDeviceSize minOffsetAlignment)
         : _rDevice(rDevice),
           _instanceSize(instanceSize),
           _instanceCount(instanceCount),
-          _usageFlags(usageFlags),
-          _memoryPropertyFlags(memPropertyFlags)
+          _usageFlags(usageFlags)
     {
         _alignmentSize = GetMinimumAlignmentSize(instanceSize, minOffsetAlignment);
         _bufferSize = _alignmentSize * instanceCount;
         
         _rDevice.CreateBuffer(_bufferSize, 
                               usageFlags, 
-                              memPropertyFlags, 
+                              preferredMemPropertyFlags, 
                               _buffer, 
-                              _bufferMemory);
+                              _bufferMemory,
+                              _memoryPropertyFlags);
     }
 
     SolBuffer::~SolBuffer()
@@ -31,15 +45,18 @@ namespace SolEngine
 
     VkResult SolBuffer::Map(const VkDeviceSize size, const VkDeviceSize offset)
     {
-        DBG_ASSERT_MSG(_buffer && _bufferMemory,
+        DBG_ASSERT_MSG(_buffer && _bufferMemory.memory,
                        "Map invoked on before before creation!");
 
-        return vkMapMemory(_rDevice.GetDevice(),
-                           _bufferMemory, 
-                           offset, 
-                           size, 
-                           0, 
-                           &_pMappedData);
+        // Host visible blocks are mapped once by the allocator, since the memory is shared with other buffers
+        if (_bufferMemory.pMappedData == nullptr)
+        {
+            return VK_ERROR_MEMORY_MAP_FAILED;
+        }
+
+        _pMappedData = static_cast<uint8_t*>(_bufferMemory.pMappedData) + offset;
+
+        return VK_SUCCESS;
     }
 
     void SolBuffer::Unmap()
@@ -49,7 +66,6 @@ namespace SolEngine
             return;
         }
 
-        vkUnmapMemory(_rDevice.GetDevice(), _bufferMemory);
         _pMappedData = nullptr;
     }
 
@@ -73,18 +89,9 @@ namespace SolEngine
 
     VkResult SolBuffer::FlushBuffer(const VkDeviceSize size, const VkDeviceSize offset) const
     {
-        const uint32_t memoryRangeCount{ 1U };
-        const VkMappedMemoryRange mappedMemRange
-        {
-            .sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
-            .memory = _bufferMemory,
-            .offset = offset,
-            .size   = size
-        };
-
-        return vkFlushMappedMemoryRanges(_rDevice.GetDevice(),
-                                         memoryRangeCount, 
-                                         &mappedMemRange);
+        return _rDevice.GetMemoryAllocator().Flush(_bufferMemory, 
+                                                   size, 
+                                                   offset);
     }
 
     VkDescriptorBufferInfo SolBuffer::DescriptorBufferInfo(const VkDeviceSize size, const VkDeviceSize offset) const
@@ -99,18 +106,9 @@ namespace SolEngine
 
     VkResult SolBuffer::InvalidateBuffer(const VkDeviceSize size, const VkDeviceSize offset) const
     {
-        const uint32_t memoryRangeCount{ 1U };
-        const VkMappedMemoryRange mappedMemRange
-        {
-            .sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
-            .memory = _bufferMemory,
-            .offset = offset,
-            .size   = size
-        };
-
-        return vkInvalidateMappedMemoryRanges(_rDevice.GetDevice(),
-                                              memoryRangeCount, 
-                                              &mappedMemRange);
+        return _rDevice.GetMemoryAllocator().Invalidate(_bufferMemory, 
+                                                        size, 
+                                                        offset);
     }
 
     void SolBuffer::WriteToIndex(void* pData, const size_t index) const
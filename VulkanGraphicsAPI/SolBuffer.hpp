@@ -11,6 +11,13 @@ namespace SolEngine
         SolBuffer(SolDevice& rDevice, const VkDeviceSize& instanceSize, const uint32_t instanceCount, 
                   const VkBufferUsageFlags usageFlags, const VkMemoryPropertyFlags memPropertyFlags, const VkDeviceSize minOffsetAlignment = 1);
 
+        /// <summary>
+        /// Uses the first set of memory properties the device supports.
+        /// GetMemoryPropertyFlags() returns what was actually chosen.
+        /// </summary>
+        SolBuffer(SolDevice& rDevice, const VkDeviceSize& instanceSize, const uint32_t instanceCount, 
+                  const VkBufferUsageFlags usageFlags, const std::vector<VkMemoryPropertyFlags>& preferredMemPropertyFlags, const VkDeviceSize minOffsetAlignment = 1);
+
         ~SolBuffer();
 
         VkResult Map(const VkDeviceSize size = VK_WHOLE_SIZE, const VkDeviceSize offset = 0);
@@ -52,7 +59,7 @@ namespace SolEngine
         SolDevice&     _rDevice;
         void*          _pMappedData  { nullptr };
         VkBuffer       _buffer       { VK_NULL_HANDLE };
-        VkDeviceMemory _bufferMemory { VK_NULL_HANDLE };
+        MemoryAllocation _bufferMemory{};
 
         VkDeviceSize          _bufferSize;
         uint32_t              _instanceCount{ 0 };
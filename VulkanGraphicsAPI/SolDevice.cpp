@@ -10,8 +10,13 @@ namespace SolEngine
         CreateVulkanInstance();
         CreateVulkanSurface();
         CreateVulkanPhysicalDevice();
+        QueryPhysicalDeviceProperties();
         CreateVulkanDevice();
 
+        _pMemoryAllocator = std::make_unique<SolMemoryAllocator>(_device, 
+                                                                 _memoryProperties,
+                                                                 _properties.limits.nonCoherentAtomSize);
+
 #ifdef ENABLE_VULKAN_DEBUG_CALLBACK
         // Optional - Setup debug callbacks so Vulkan 
         // can tell us if something has gone wrong.
@@ -19,6 +24,7 @@ namespace SolEngine
 #endif // ENABLE_VULKAN_DEBUG_CALLBACK
 
         CreateVulkanCommandPool();
+        CreateVulkanPipelineCache();
     }
 
     SolDevice::~SolDevice()
@@ -29,7 +35,7 @@ namespace SolEngine
     void SolDevice::CreateImageWithInfo(const VkImageCreateInfo& imageCreateInfo, 
                                         const VkMemoryPropertyFlags properties, 
                                         VkImage& rImage, 
-                                        VkDeviceMemory& rImageMemory)
+                                        MemoryAllocation& rImageMemory)
     {
         VkResult result = vkCreateImage(_device, 
                                         &imageCreateInfo,
@@ -44,46 +50,91 @@ namespace SolEngine
                                      rImage,
                                      &imageMemoryRequirements);
 
-        const VkMemoryAllocateInfo memoryAllocateInfo
-        {
-            .sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-            .allocationSize  = imageMemoryRequirements.size,
-            .memoryTypeIndex = FindMemoryType(imageMemoryRequirements.memoryTypeBits, 
-                                              properties)
-        };
+        uint32_t memoryTypeIndex;
+
+        const bool isMemoryTypeFound = FindMemoryType(imageMemoryRequirements.memoryTypeBits, 
+                                                      properties, 
+                                                      memoryTypeIndex);
 
-        result = vkAllocateMemory(_device, 
-                                  &memoryAllocateInfo,
-                                  NULL,
-                                  &rImageMemory);
+        DBG_ASSERT_MSG(isMemoryTypeFound, "Failed to find a suitable Memory Type for Image.");
 
-        DBG_ASSERT_VULKAN_MSG(result, "Failed to allocate Image Memory.");
+        rImageMemory = _pMemoryAllocator->Allocate(imageMemoryRequirements,
+                                                   memoryTypeIndex,
+                                                   true);
 
         result = vkBindImageMemory(_device, 
                                    rImage,
-                                   rImageMemory,
-                                   0);
+                                   rImageMemory.memory,
+                                   rImageMemory.offset);
 
         DBG_ASSERT_VULKAN_MSG(result, "Failed to Bind Image Memory.");
     }
 
-    uint32_t SolDevice::FindMemoryType(const uint32_t typeFilter, const VkMemoryPropertyFlags properties) const
+    void SolDevice::DisposeImage(const VkImage image, 
+                                 const MemoryAllocation& memory)
     {
-        VkPhysicalDeviceMemoryProperties physicalDeviceMemoryProperties{};
+        vkDestroyImage(_device, image, NULL);
+        _pMemoryAllocator->Free(memory);
+    }
+
+    bool SolDevice::FindMemoryType(const uint32_t typeFilter, 
+                                   const VkMemoryPropertyFlags properties, 
+                                   uint32_t& rMemoryTypeIndex) const
+    {
+        const uint64_t key = (static_cast<uint64_t>(typeFilter) << 32) | properties;
+
+        const std::lock_guard<std::mutex> lock(_memoryTypeMutex);
 
-        vkGetPhysicalDeviceMemoryProperties(_physicalDevice,
-                                            &physicalDeviceMemoryProperties);
+        const auto memoryTypeIt = _memoryTypeIndices.find(key);
 
-        for (uint32_t i(0); i < physicalDeviceMemoryProperties.memoryTypeCount; ++i)
+        if (memoryTypeIt != _memoryTypeIndices.end())
+        {
+            rMemoryTypeIndex = memoryTypeIt->second;
+
+            return rMemoryTypeIndex != INVALID_MEMORY_TYPE_INDEX;
+        }
+
+        rMemoryTypeIndex = INVALID_MEMORY_TYPE_INDEX;
+
+        for (uint32_t i(0); i < _memoryProperties.memoryTypeCount; ++i)
         {
             if ((typeFilter & (1 << i)) &&
-                (physicalDeviceMemoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+                (_memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
             {
-                return i;
+                rMemoryTypeIndex = i;
+                break;
             }
         }
 
-        return -1;
+        // Remember misses too, so fallbacks don't rescan every time
+        _memoryTypeIndices.emplace(key, rMemoryTypeIndex);
+
+        return rMemoryTypeIndex != INVALID_MEMORY_TYPE_INDEX;
+    }
+
+    bool SolDevice::FindPreferredMemoryType(const uint32_t typeFilter, 
+                                            const std::vector<VkMemoryPropertyFlags>& preferredProperties, 
+                                            uint32_t& rMemoryTypeIndex) const
+    {
+        for (const VkMemoryPropertyFlags properties : preferredProperties)
+        {
+            if (FindMemoryType(typeFilter, properties, rMemoryTypeIndex))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool SolDevice::IsDeviceLocalHostVisibleMemorySupported() const
+    {
+        uint32_t memoryTypeIndex(0);
+
+        // No buffer to filter by yet, so allow any memory type
+        return FindMemoryType((std::numeric_limits<uint32_t>::max)(), 
+                              VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, 
+                              memoryTypeIndex);
     }
 
     VkFormat SolDevice::FindSupportedFormat(const std::vector<VkFormat>& candidates,
@@ -114,7 +165,24 @@ namespace SolEngine
                                  const VkBufferUsageFlags usage, 
                                  const VkMemoryPropertyFlags properties, 
                                  VkBuffer& rBuffer, 
-                                 VkDeviceMemory& rBufferMemory)
+                                 MemoryAllocation& rBufferMemory)
+    {
+        VkMemoryPropertyFlags actualProperties;
+
+        CreateBuffer(bufferSize,
+                     usage,
+                     { properties },
+                     rBuffer,
+                     rBufferMemory,
+                     actualProperties);
+    }
+
+    void SolDevice::CreateBuffer(const VkDeviceSize bufferSize,
+                                 const VkBufferUsageFlags usage, 
+                                 const std::vector<VkMemoryPropertyFlags>& preferredProperties, 
+                                 VkBuffer& rBuffer, 
+                                 MemoryAllocation& rBufferMemory,
+                                 VkMemoryPropertyFlags& rOutProperties)
     {
         const VkBufferCreateInfo bufferCreateInfo
         {
@@ -134,26 +202,27 @@ namespace SolEngine
                                       rBuffer, 
                                       &memoryRequirements);
 
-        const VkMemoryAllocateInfo memoryAllocateInfo
-        {
-            .sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-            .allocationSize  = memoryRequirements.size,
-            .memoryTypeIndex = FindMemoryType(memoryRequirements.memoryTypeBits, 
-                                              properties)
-        };
+        uint32_t memoryTypeIndex;
+
+        const bool isMemoryTypeFound = FindPreferredMemoryType(memoryRequirements.memoryTypeBits, 
+                                                               preferredProperties, 
+                                                               memoryTypeIndex);
 
-        result = vkAllocateMemory(_device, 
-                                  &memoryAllocateInfo, 
-                                  NULL,
-                                  &rBufferMemory);
+        DBG_ASSERT_MSG(isMemoryTypeFound, "Failed to find a suitable Memory Type for Buffer.");
 
-        DBG_ASSERT_VULKAN_MSG(result, "Failed to Allocate Buffer Memory.");
+        // The chosen type may have more properties than asked for, e.g. HOST_COHERENT
+        rOutProperties = _memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags;
+
+        // Sub-allocated from a shared block rather than a vkAllocateMemory per buffer
+        rBufferMemory = _pMemoryAllocator->Allocate(memoryRequirements,
+                                                    memoryTypeIndex,
+                                                    false);
 
         // Bind buffer to allocated memory
         result = vkBindBufferMemory(_device, 
                                     rBuffer,
-                                    rBufferMemory,
-                                    0);
+                                    rBufferMemory.memory,
+                                    rBufferMemory.offset);
 
         DBG_ASSERT_VULKAN_MSG(result, "Failed to Bind Buffer Memory!");
     }
@@ -177,15 +246,22 @@ namespace SolEngine
     }
 
     void SolDevice::DisposeBuffer(const VkBuffer buffer, 
-                                  const VkDeviceMemory memory,
+                                  const MemoryAllocation& memory,
                                   const VkAllocationCallbacks* pAllocator)
     {
         vkDestroyBuffer(_device, buffer, pAllocator);
-        vkFreeMemory(_device, memory, pAllocator);
+        _pMemoryAllocator->Free(memory);
     }
 
     void SolDevice::Dispose()
     {
+        // Keep everything compiled this run for the next one
+        SavePipelineCache();
+
+        // Every buffer and image should be gone by now, so this frees the blocks themselves
+        _pMemoryAllocator = nullptr;
+
+        vkDestroyPipelineCache(_device, _pipelineCache, NULL);
         vkDestroyCommandPool(_device, _commandPool, NULL);
         vkDestroyDevice(_device, NULL);
         vkDestroySurfaceKHR(_instance, _surface, NULL);
@@ -294,6 +370,12 @@ namespace SolEngine
         }
     }
 
+    void SolDevice::QueryPhysicalDeviceProperties()
+    {
+        vkGetPhysicalDeviceProperties(_physicalDevice, &_properties);
+        vkGetPhysicalDeviceMemoryProperties(_physicalDevice, &_memoryProperties);
+    }
+
     void SolDevice::CreateVulkanDevice()
     {
         std::vector<VkDeviceQueueCreateInfo> deviceQueueCreateInfos;
@@ -320,21 +402,41 @@ namespace SolEngine
             deviceQueueCreateInfos.push_back(deviceQueueCreateInfo);
         }
 
-        const VkPhysicalDeviceFeatures deviceFeatures
+        VkPhysicalDeviceFeatures supportedFeatures{};
+        vkGetPhysicalDeviceFeatures(_physicalDevice, &supportedFeatures);
+
+        _enabledFeatures =
         {
+            .multiDrawIndirect  = supportedFeatures.multiDrawIndirect,  // Every mesh chunk in one indirect draw
+            .fillModeNonSolid   = supportedFeatures.fillModeNonSolid,   // Wireframe and Point polygon modes
             .shaderClipDistance = VK_TRUE
         };
 
+        // Lets the cull mode be changed whilst recording, instead of needing a pipeline per cull mode
+        const bool isExtendedDynamicStateSupported = IsExtendedDynamicStateSupported();
+
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT extendedDynamicStateFeatures
+        {
+            .sType                = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT,
+            .extendedDynamicState = VK_TRUE
+        };
+
+        if (isExtendedDynamicStateSupported)
+        {
+            _logicalDeviceExtensions.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+        }
+
         const VkDeviceCreateInfo deviceCreateInfo
         {
             .sType                   = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+            .pNext                   = isExtendedDynamicStateSupported ? &extendedDynamicStateFeatures : NULL,
             .queueCreateInfoCount    = static_cast<uint32_t>(deviceQueueCreateInfos.size()),
             .pQueueCreateInfos       = deviceQueueCreateInfos.data(),
             .enabledLayerCount       = GetEnabledLayerCount(),
             .ppEnabledLayerNames     = _enabledLayerNames.data(),
             .enabledExtensionCount   = GetDeviceExtensionCount(),
             .ppEnabledExtensionNames = _logicalDeviceExtensions.data(),
-            .pEnabledFeatures        = &deviceFeatures
+            .pEnabledFeatures        = &_enabledFeatures
         };
 
         // Ideally, want to enumerate to find best device.
@@ -349,6 +451,11 @@ namespace SolEngine
 
         vkGetDeviceQueue(_device, queueFamilyIndices.graphicsFamily, 0, &_graphicsQueue);
         vkGetDeviceQueue(_device, queueFamilyIndices.presentFamily, 0, &_presentQueue);
+
+        if (isExtendedDynamicStateSupported)
+        {
+            _pfnCmdSetCullMode = (PFN_vkCmdSetCullModeEXT)vkGetDeviceProcAddr(_device, "vkCmdSetCullModeEXT");
+        }
     }
 
     void SolDevice::CreateVulkanCommandPool()
@@ -380,6 +487,108 @@ namespace SolEngine
         DBG_ASSERT_VULKAN_MSG(result, "Failed to create Command Pool.");
     }
 
+    void SolDevice::CreateVulkanPipelineCache()
+    {
+        // Seed the cache with the last run's pipelines, so they don't have to be compiled from scratch
+        const SolMappedFile cacheFile(PIPELINE_CACHE_FILE_PATH);
+        const bool          isCacheFileUsable = cacheFile.IsValid() && 
+                                                IsPipelineCacheCompatible(cacheFile.GetData(), cacheFile.GetSize());
+
+        const VkPipelineCacheCreateInfo pipelineCacheCreateInfo
+        {
+            .sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+            .initialDataSize = isCacheFileUsable ? cacheFile.GetSize() : 0U,
+            .pInitialData    = isCacheFileUsable ? cacheFile.GetData() : NULL
+        };
+
+        const VkResult result = vkCreatePipelineCache(_device,
+                                                      &pipelineCacheCreateInfo,
+                                                      NULL,
+                                                      &_pipelineCache);
+
+        // Was is successful?
+        DBG_ASSERT_VULKAN_MSG(result, "Failed to create Pipeline Cache.");
+    }
+
+    void SolDevice::SavePipelineCache() const
+    {
+        size_t   cacheSizeBytes(0U);
+        VkResult result = vkGetPipelineCacheData(_device, 
+                                                 _pipelineCache, 
+                                                 &cacheSizeBytes, 
+                                                 NULL);
+
+        if (result != VK_SUCCESS || cacheSizeBytes == 0U)
+        {
+            return;
+        }
+
+        std::vector<char> cacheData(cacheSizeBytes);
+
+        result = vkGetPipelineCacheData(_device, 
+                                        _pipelineCache, 
+                                        &cacheSizeBytes, 
+                                        cacheData.data());
+
+        if (result != VK_SUCCESS)
+        {
+            return;
+        }
+
+        const std::filesystem::path cachePath(PIPELINE_CACHE_FILE_PATH);
+        const std::filesystem::path temporaryPath = cachePath.string() + ".tmp";
+        std::error_code             errorCode{};
+
+        std::filesystem::create_directories(cachePath.parent_path(), errorCode);
+
+        // Write to a temporary file first, a half written cache would just be thrown away next run
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+
+            if (!file.is_open())
+            {
+                return;
+            }
+
+            file.write(cacheData.data(), cacheSizeBytes);
+
+            if (!file.good())
+            {
+                return;
+            }
+        }
+
+        std::filesystem::rename(temporaryPath, cachePath, errorCode);
+    }
+
+    bool SolDevice::IsPipelineCacheCompatible(const uint8_t* pCacheData, 
+                                              const size_t cacheSizeBytes) const
+    {
+        if (cacheSizeBytes < sizeof(VkPipelineCacheHeaderVersionOne))
+        {
+            return false;
+        }
+
+        VkPipelineCacheHeaderVersionOne cacheHeader{};
+        memcpy(&cacheHeader, pCacheData, sizeof(VkPipelineCacheHeaderVersionOne));
+
+        // Caches are only valid for the exact device and driver that wrote them
+        const bool isCompatible = cacheHeader.headerSize >= sizeof(VkPipelineCacheHeaderVersionOne)   &&
+                                  cacheHeader.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE   &&
+                                  cacheHeader.vendorID == _properties.vendorID                        &&
+                                  cacheHeader.deviceID == _properties.deviceID                        &&
+                                  memcmp(cacheHeader.pipelineCacheUUID, 
+                                         _properties.pipelineCacheUUID, 
+                                         VK_UUID_SIZE) == 0;
+
+        if (!isCompatible)
+        {
+            DebugHelpers::DPrintf("Pipeline Cache was created by a different device or driver, discarding.\n");
+        }
+
+        return isCompatible;
+    }
+
     VkCommandBuffer SolDevice::BeginOneTimeCommandBuffer()
     {
         const VkCommandBufferAllocateInfo allocateInfo
@@ -494,6 +703,54 @@ namespace SolEngine
     }
 #endif // ENABLE_VULKAN_DEBUG_CALLBACK
 
+    bool SolDevice::IsDeviceExtensionSupported(const char* extensionName) const
+    {
+        uint32_t extensionCount(0U);
+
+        vkEnumerateDeviceExtensionProperties(_physicalDevice, 
+                                             NULL, 
+                                             &extensionCount, 
+                                             NULL);
+
+        std::vector<VkExtensionProperties> extensions(extensionCount);
+
+        vkEnumerateDeviceExtensionProperties(_physicalDevice, 
+                                             NULL, 
+                                             &extensionCount, 
+                                             extensions.data());
+
+        return std::any_of(extensions.begin(), 
+                           extensions.end(), 
+                           [extensionName](const VkExtensionProperties& extension)
+                           {
+                               return strcmp(extension.extensionName, extensionName) == 0;
+                           });
+    }
+
+    bool SolDevice::IsExtendedDynamicStateSupported() const
+    {
+        if (!IsDeviceExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME))
+        {
+            return false;
+        }
+
+        // The extension being listed doesn't guarantee the feature is, so check that too
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT extendedDynamicStateFeatures
+        {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT
+        };
+
+        VkPhysicalDeviceFeatures2 features
+        {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+            .pNext = &extendedDynamicStateFeatures
+        };
+
+        vkGetPhysicalDeviceFeatures2(_physicalDevice, &features);
+
+        return extendedDynamicStateFeatures.extendedDynamicState == VK_TRUE;
+    }
+
     SwapchainSupportDetails SolDevice::QuerySwapchainSupport(const VkPhysicalDevice& physicalDevice) const
     {
         VkResult result;
@@ -3,9 +3,15 @@
 #define ENABLE_VULKAN_DEBUG_CALLBACK
 #endif
 
+#include <filesystem>
+#include <mutex>
+#include <fstream>
 #include <set>
+#include <unordered_map>
 
 #include "SolWindow.hpp"
+#include "SolMappedFile.hpp"
+#include "SolMemoryAllocator.hpp"
 #include "SwapchainSupportDetails.hpp"
 #include "QueueFamilyIndices.hpp"
 
@@ -35,40 +41,84 @@ namespace SolEngine
         VkPhysicalDevice GetPhysicalDevice()        const { return _physicalDevice; }
         VkSurfaceKHR     GetSurface()		        const { return _surface; }
         VkCommandPool    GetCommandPool()	        const { return _commandPool; }
+        VkPipelineCache  GetPipelineCache()         const { return _pipelineCache; }
         VkQueue          GetGraphicsQueue()         const { return _graphicsQueue; }
         VkQueue          GetPresentQueue()          const { return _presentQueue; }
         uint32_t         GetEnabledLayerCount()	    const { return static_cast<uint32_t>(_enabledLayerNames.size()); }
         uint32_t         GetEnabledExtensionCount() const { return static_cast<uint32_t>(_enabledExtensionNames.size()); }
         uint32_t         GetDeviceExtensionCount()  const { return static_cast<uint32_t>(_logicalDeviceExtensions.size()); }
 
-        void CreateImageWithInfo(const VkImageCreateInfo& imageCreateInfo, const VkMemoryPropertyFlags properties, VkImage& rImage, VkDeviceMemory& rImageMemory);
+        const SolMemoryAllocator&               GetMemoryAllocator()            const { return *_pMemoryAllocator; }
+        const VkPhysicalDeviceFeatures&         GetEnabledFeatures()            const { return _enabledFeatures; }
+        const VkPhysicalDeviceProperties&       GetProperties()                 const { return _properties; }
+        const VkPhysicalDeviceMemoryProperties& GetMemoryProperties()           const { return _memoryProperties; }
+        bool                                    IsExtendedDynamicStateEnabled() const { return _pfnCmdSetCullMode != NULL; }
+
+        /// <summary>
+        /// Sets the cull mode of the bound pipeline. Requires IsExtendedDynamicStateEnabled().
+        /// </summary>
+        void CmdSetCullMode(const VkCommandBuffer commandBuffer, const VkCullModeFlags cullMode) const { _pfnCmdSetCullMode(commandBuffer, cullMode); }
+
+        void CreateImageWithInfo(const VkImageCreateInfo& imageCreateInfo, const VkMemoryPropertyFlags properties, VkImage& rImage, MemoryAllocation& rImageMemory);
+
+        /// <summary>
+        /// Destroys the image and returns it's memory to the allocator.
+        /// </summary>
+        void DisposeImage(const VkImage image, const MemoryAllocation& memory);
 
         SwapchainSupportDetails QueryPhysicalDeviceSwapchainSupport() const { return QuerySwapchainSupport(_physicalDevice); }
         QueueFamilyIndices      QueryPhysicalDeviceQueueFamilies()    const { return QueryQueueFamilies(_physicalDevice); }
 
-        uint32_t FindMemoryType(const uint32_t typeFilter, const VkMemoryPropertyFlags properties) const;
+        /// <summary>
+        /// Finds the first memory type allowed by the filter with all of the properties.
+        /// Results are remembered, so repeat lookups skip the scan.
+        /// </summary>
+        /// <returns>False if no memory type fits.</returns>
+        bool FindMemoryType(const uint32_t typeFilter, const VkMemoryPropertyFlags properties, uint32_t& rMemoryTypeIndex) const;
+
+        /// <summary>
+        /// Tries each set of properties in order of preference, e.g. DEVICE_LOCAL | HOST_VISIBLE before plain HOST_VISIBLE.
+        /// </summary>
+        /// <returns>False if none of them fit.</returns>
+        bool FindPreferredMemoryType(const uint32_t typeFilter, const std::vector<VkMemoryPropertyFlags>& preferredProperties, uint32_t& rMemoryTypeIndex) const;
+
+        /// <summary>
+        /// True on Unified Memory and ReBAR devices, where the CPU can write straight into memory the GPU reads at full speed.
+        /// </summary>
+        bool IsDeviceLocalHostVisibleMemorySupported() const;
+
         VkFormat FindSupportedFormat(const std::vector<VkFormat>& candidates, const VkImageTiling tiling, const VkFormatFeatureFlags features) const;
 
         // Buffer Helper Functions
         VkCommandBuffer BeginOneTimeCommandBuffer();
         void            EndOneTimeCommandBuffer(const VkCommandBuffer commandBuffer);
-        void            CreateBuffer(const VkDeviceSize bufferSize, const VkBufferUsageFlags usage, const VkMemoryPropertyFlags properties, VkBuffer& rBuffer, VkDeviceMemory& rBufferMemory);
+        void            CreateBuffer(const VkDeviceSize bufferSize, const VkBufferUsageFlags usage, const VkMemoryPropertyFlags properties, VkBuffer& rBuffer, MemoryAllocation& rBufferMemory);
+        void            CreateBuffer(const VkDeviceSize bufferSize, const VkBufferUsageFlags usage, const std::vector<VkMemoryPropertyFlags>& preferredProperties, 
+                                     VkBuffer& rBuffer, MemoryAllocation& rBufferMemory, VkMemoryPropertyFlags& rOutProperties);
         void            CopyBuffer(const VkBuffer srcBuffer, const VkBuffer dstBuffer, const VkDeviceSize size);
 
         /// <summary>
-        /// Destroys the buffer and frees it's memory.
+        /// Destroys the buffer and returns it's memory to the allocator.
         /// </summary>
-        void DisposeBuffer(const VkBuffer buffer, const VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator = NULL);
+        void DisposeBuffer(const VkBuffer buffer, const MemoryAllocation& memory, const VkAllocationCallbacks* pAllocator = NULL);
 
     private:
+        static constexpr const char* PIPELINE_CACHE_FILE_PATH { "Cache/PipelineCache.bin" };
+        static constexpr uint32_t    INVALID_MEMORY_TYPE_INDEX{ (std::numeric_limits<uint32_t>::max)() };
+
         // Inherited via IDisposable
         virtual void Dispose() override;
 
         void CreateVulkanInstance();
         void CreateVulkanSurface() { _rSolWindow.CreateWindowSurface(_instance, &_surface); };
         void CreateVulkanPhysicalDevice();
+        void QueryPhysicalDeviceProperties();
         void CreateVulkanDevice();
         void CreateVulkanCommandPool();
+        void CreateVulkanPipelineCache();
+
+        void SavePipelineCache() const;
+        bool IsPipelineCacheCompatible(const uint8_t* pCacheData, const size_t cacheSizeBytes) const;
 
 #ifdef ENABLE_VULKAN_DEBUG_CALLBACK
         void CreateVulkanDebugCallback();
@@ -78,6 +128,8 @@ namespace SolEngine
 #endif // ENABLE_VULKAN_DEBUG_CALLBACK
 
         // Helper Functions
+        bool                    IsDeviceExtensionSupported(const char* extensionName) const;
+        bool                    IsExtendedDynamicStateSupported() const;
         SwapchainSupportDetails QuerySwapchainSupport(const VkPhysicalDevice& physicalDevice) const;
         QueueFamilyIndices      QueryQueueFamilies(const VkPhysicalDevice& physicalDevice) const;
 
@@ -89,6 +141,19 @@ namespace SolEngine
         VkPhysicalDevice _physicalDevice{ NULL };
         VkSurfaceKHR     _surface       { NULL };
         VkCommandPool    _commandPool   { NULL };
+        VkPipelineCache  _pipelineCache { NULL };
+
+        std::unique_ptr<SolMemoryAllocator> _pMemoryAllocator;
+
+        // Queried once, these never change for the life of the device
+        VkPhysicalDeviceProperties       _properties      {};
+        VkPhysicalDeviceMemoryProperties _memoryProperties{};
+
+        mutable std::mutex                             _memoryTypeMutex;
+        mutable std::unordered_map<uint64_t, uint32_t> _memoryTypeIndices;   // (typeFilter << 32 | properties) -> Index, or INVALID_MEMORY_TYPE_INDEX
+
+        VkPhysicalDeviceFeatures _enabledFeatures  {};
+        PFN_vkCmdSetCullModeEXT  _pfnCmdSetCullMode{ NULL };  // Only loaded when VK_EXT_extended_dynamic_state is enabled
         VkQueue          _graphicsQueue { NULL };
         VkQueue          _presentQueue  { NULL };
 
@@ -0,0 +1,28 @@
+#pragma once
+#include <array>
+
+#include "SolSwapchain.hpp"
+
+namespace SolEngine
+{
+    /// <summary>
+    /// One T per frame in flight, indexed by SolRenderer::GetFrameIndex().
+    /// A slot is only reused once the GPU has finished the frame that last used it.
+    /// </summary>
+    template<typename T>
+    class SolFrameRing
+    {
+    public:
+        T&       operator[](const size_t frameIndex)       { return _frames.at(frameIndex); }
+        const T& operator[](const size_t frameIndex) const { return _frames.at(frameIndex); }
+
+        // Iterates every slot, including those beyond the current frames in flight count
+        auto begin()       { return _frames.begin(); }
+        auto end()         { return _frames.end(); }
+        auto begin() const { return _frames.begin(); }
+        auto end()   const { return _frames.end(); }
+
+    private:
+        std::array<T, SolSwapchain::MAX_FRAMES_IN_FLIGHT> _frames{};
+    };
+}
@@ -22,8 +22,7 @@ namespace SolEngine
     {
         const size_t nodeCount = _rGridSettings.GetNodeCount();
 
-        DefaultLiveNeighbours(cells.pLiveNeighbourCounts, nodeCount);
-        GenerateRandomStates(cells.pCellStates, nodeCount);
+        GenerateRandomStates(cells.pCellStates, nodeCount, _rGridSettings.liveCellDensity);
     }
 
     void SolGrid::Initialise()
@@ -43,13 +42,20 @@ namespace SolEngine
 
     void SolGrid::TraverseAllGridCells(const TraverseCubesCallback_t& callback)
     {
-        const glm::uvec3 gridDimensions = GetDimensions();
+        TraverseGridCells(glm::uvec3(0U), 
+                          GetDimensions(), 
+                          callback);
+    }
 
-        for (uint32_t z(0U); z < gridDimensions.z; ++z)
+    void SolGrid::TraverseGridCells(const glm::uvec3& minCellIndices, 
+                                    const glm::uvec3& maxCellIndices, 
+                                    const TraverseCubesCallback_t& callback)
+    {
+        for (uint32_t z(minCellIndices.z); z < maxCellIndices.z; ++z)
         {
-            for (uint32_t y(0U); y < gridDimensions.y; ++y)
+            for (uint32_t y(minCellIndices.y); y < maxCellIndices.y; ++y)
             {
-                for (uint32_t x(0U); x < gridDimensions.x; ++x)
+                for (uint32_t x(minCellIndices.x); x < maxCellIndices.x; ++x)
                 {
                     callback(x, y, z);
                 }
@@ -62,11 +68,8 @@ namespace SolEngine
         const size_t nodeCount = _rGridSettings.GetNodeCount();
         size_t nodesBytesInUse(0);
 
-        nodesBytesInUse += GenerateVertices<Axis::X>(cells.pXVertices, _minBounds.x, _maxBounds.x);
-        nodesBytesInUse += GenerateVertices<Axis::Y>(cells.pYVertices, _minBounds.y, _maxBounds.y);
-        nodesBytesInUse += GenerateVertices<Axis::Z>(cells.pZVertices, _minBounds.z, _maxBounds.z);
-        nodesBytesInUse += DefaultLiveNeighbours(cells.pLiveNeighbourCounts, nodeCount);
-        nodesBytesInUse += GenerateRandomStates(cells.pCellStates, nodeCount);
+        nodesBytesInUse += GenerateRandomStates(cells.pCellStates, nodeCount, _rGridSettings.liveCellDensity);
+        nodesBytesInUse += nodeCount * sizeof(bool);    // Next generation back buffer
 
         _rDiagnosticData.gridMemoryUsedBytes = nodesBytesInUse;
     }
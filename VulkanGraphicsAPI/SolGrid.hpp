@@ -29,10 +29,16 @@ namespace SolEngine
 
 		bool			  IsGridDataValid() const { return _isGridDataValid; }
 		const glm::uvec3& GetDimensions()   const { return _rGridSettings.dimensions; }
+		const glm::ivec3& GetMinBounds()    const { return _minBounds; }
 
 		void Initialise();
 		void TraverseAllGridCells(const TraverseCubesCallback_t& callback);
 
+		/// <summary>
+		/// Visits every cell in [minCellIndices, maxCellIndices), in the same order as TraverseAllGridCells.
+		/// </summary>
+		void TraverseGridCells(const glm::uvec3& minCellIndices, const glm::uvec3& maxCellIndices, const TraverseCubesCallback_t& callback);
+
 		Cells cells;
 
 	private:
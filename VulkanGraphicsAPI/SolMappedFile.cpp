@@ -0,0 +1,70 @@
+#include "SolMappedFile.hpp"
+
+namespace SolEngine
+{
+    SolMappedFile::SolMappedFile(const std::string& filePath)
+    {
+        _fileHandle = CreateFileA(filePath.c_str(), 
+                                  GENERIC_READ, 
+                                  FILE_SHARE_READ, 
+                                  NULL, 
+                                  OPEN_EXISTING, 
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, 
+                                  NULL);
+
+        if (_fileHandle == INVALID_HANDLE_VALUE)
+        {
+            printf_s("Failed to open file for mapping: %s\n", filePath.c_str());
+
+            return;
+        }
+
+        LARGE_INTEGER fileSize{};
+
+        // Empty files can't be mapped
+        if (!GetFileSizeEx(_fileHandle, &fileSize) || fileSize.QuadPart == 0)
+        {
+            return;
+        }
+
+        _mappingHandle = CreateFileMappingA(_fileHandle, 
+                                            NULL, 
+                                            PAGE_READONLY, 
+                                            0, 
+                                            0, 
+                                            NULL);
+
+        if (_mappingHandle == NULL)
+        {
+            printf_s("Failed to create file mapping: %s\n", filePath.c_str());
+
+            return;
+        }
+
+        _pData     = (const uint8_t*)MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        _sizeBytes = _pData != nullptr ? (size_t)fileSize.QuadPart : 0U;
+    }
+
+    SolMappedFile::~SolMappedFile()
+    {
+        Dispose();
+    }
+
+    void SolMappedFile::Dispose()
+    {
+        if (_pData != nullptr)
+        {
+            UnmapViewOfFile(_pData);
+        }
+
+        if (_mappingHandle != NULL)
+        {
+            CloseHandle(_mappingHandle);
+        }
+
+        if (_fileHandle != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(_fileHandle);
+        }
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <string>
+
+#include "DebugHelpers.hpp"
+#include "IDisposable.hpp"
+
+using namespace SolEngine::Interface;
+
+namespace SolEngine
+{
+    /// <summary>
+    /// Read-only view of a whole file mapped into memory.
+    /// Pages are only read from disk as they are touched, so opening a large file is near instant.
+    /// </summary>
+    class SolMappedFile : private IDisposable
+    {
+    public:
+        SolMappedFile(const std::string& filePath);
+        ~SolMappedFile();
+
+        SolMappedFile(const SolMappedFile&)            = delete;
+        SolMappedFile& operator=(const SolMappedFile&) = delete;
+
+        bool           IsValid() const { return _pData != nullptr; }
+        const uint8_t* GetData() const { return _pData; }
+        size_t         GetSize() const { return _sizeBytes; }
+
+    private:
+        // Inherited via IDisposable
+        virtual void Dispose() override;
+
+        HANDLE         _fileHandle   { INVALID_HANDLE_VALUE };
+        HANDLE         _mappingHandle{ NULL };
+        const uint8_t* _pData        { nullptr };
+        size_t         _sizeBytes    { 0U };
+    };
+}
@@ -0,0 +1,357 @@
+#include <algorithm>
+#include <bit>
+
+#include "SolMemoryAllocator.hpp"
+
+namespace SolEngine
+{
+    SolMemoryAllocator::SolMemoryAllocator(const VkDevice device,
+                                           const VkPhysicalDeviceMemoryProperties& memoryProperties,
+                                           const VkDeviceSize nonCoherentAtomSize)
+        : _device(device),
+          _memoryProperties(memoryProperties),
+          _nonCoherentAtomSize(nonCoherentAtomSize)
+    {}
+
+    SolMemoryAllocator::~SolMemoryAllocator()
+    {
+        Dispose();
+    }
+
+    MemoryAllocation SolMemoryAllocator::Allocate(const VkMemoryRequirements& memoryRequirements,
+                                                  const uint32_t memoryTypeIndex,
+                                                  const bool isImage)
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+
+        const uint32_t poolIndex = memoryTypeIndex * 2 + (isImage ? 1 : 0);
+        MemoryPool&    rPool     = _pools.at(poolIndex);
+
+        // First use of this pool, size its blocks to the heap
+        if (rPool.blockSize == 0)
+        {
+            const uint32_t     heapIndex = _memoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+            const VkDeviceSize heapSize  = _memoryProperties.memoryHeaps[heapIndex].size;
+
+            rPool.memoryTypeIndex = memoryTypeIndex;
+            rPool.blockSize       = (std::max)(std::bit_floor((std::min)(MEMORY_BLOCK_SIZE, heapSize / HEAP_BLOCK_DIVISOR)),
+                                               MIN_BLOCK_SIZE);
+            rPool.orderCount      = GetOrder(rPool.blockSize) + 1;
+        }
+
+        // Buddies are aligned to their own size, so a big enough buddy satisfies any alignment
+        const uint32_t order = GetOrder((std::max)(memoryRequirements.size, memoryRequirements.alignment));
+
+        MemoryAllocation allocation
+        {
+            .poolIndex = poolIndex,
+            .order     = order
+        };
+
+        if (order >= rPool.orderCount)
+        {
+            return AllocateDedicated(memoryRequirements, memoryTypeIndex);
+        }
+
+        MemoryBlock* pBlock = nullptr;
+
+        for (const std::unique_ptr<MemoryBlock>& pCandidateBlock : rPool.blocks)
+        {
+            if (TryAllocateFromBlock(*pCandidateBlock, order, allocation.offset))
+            {
+                pBlock = pCandidateBlock.get();
+                break;
+            }
+        }
+
+        // Every block is full, add another
+        if (pBlock == nullptr)
+        {
+            pBlock = AddBlock(rPool);
+
+            // The heap can't fit another block, so try just what was asked for
+            if (pBlock == nullptr)
+            {
+                return AllocateDedicated(memoryRequirements, memoryTypeIndex);
+            }
+
+            TryAllocateFromBlock(*pBlock, order, allocation.offset);
+        }
+
+        allocation.memory = pBlock->memory;
+        allocation.size   = MIN_BLOCK_SIZE << order;
+
+        if (pBlock->pMappedData != nullptr)
+        {
+            allocation.pMappedData = static_cast<uint8_t*>(pBlock->pMappedData) + allocation.offset;
+        }
+
+        pBlock->usedBytes += allocation.size;
+        _usedBytes        += allocation.size;
+        ++_allocationCount;
+
+        return allocation;
+    }
+
+    void SolMemoryAllocator::Free(const MemoryAllocation& allocation)
+    {
+        if (allocation.memory == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        const std::lock_guard<std::mutex> lock(_mutex);
+
+        _usedBytes -= allocation.size;
+        --_allocationCount;
+
+        if (allocation.order == DEDICATED_ORDER)
+        {
+            vkFreeMemory(_device, allocation.memory, NULL);
+
+            _allocatedBytes -= allocation.size;
+            --_blockCount;
+
+            return;
+        }
+
+        MemoryPool& rPool = _pools.at(allocation.poolIndex);
+
+        const auto blockIt = std::find_if(rPool.blocks.begin(),
+                                          rPool.blocks.end(),
+                                          [&allocation](const std::unique_ptr<MemoryBlock>& pBlock) { return pBlock->memory == allocation.memory; });
+
+        DBG_ASSERT_MSG((blockIt != rPool.blocks.end()),
+                       "Freed memory doesn't belong to any block!");
+
+        MemoryBlock& rBlock = **blockIt;
+
+        FreeToBlock(rBlock,
+                    allocation.order,
+                    rPool.orderCount,
+                    allocation.offset);
+
+        rBlock.usedBytes -= allocation.size;
+
+        if (rBlock.usedBytes != 0)
+        {
+            return;
+        }
+
+        // Keep one empty block around, so a mesh rebuilt every generation doesn't free and reallocate it
+        const size_t emptyBlockCount = std::count_if(rPool.blocks.begin(),
+                                                     rPool.blocks.end(),
+                                                     [](const std::unique_ptr<MemoryBlock>& pBlock) { return pBlock->usedBytes == 0; });
+
+        if (emptyBlockCount < 2)
+        {
+            return;
+        }
+
+        vkFreeMemory(_device, rBlock.memory, NULL);
+
+        _allocatedBytes -= rPool.blockSize;
+        --_blockCount;
+
+        rPool.blocks.erase(blockIt);
+    }
+
+    VkResult SolMemoryAllocator::Flush(const MemoryAllocation& allocation,
+                                       const VkDeviceSize size,
+                                       const VkDeviceSize offset) const
+    {
+        const VkMappedMemoryRange mappedMemoryRange = GetMappedRange(allocation, size, offset);
+
+        return vkFlushMappedMemoryRanges(_device,
+                                         1,
+                                         &mappedMemoryRange);
+    }
+
+    VkResult SolMemoryAllocator::Invalidate(const MemoryAllocation& allocation,
+                                            const VkDeviceSize size,
+                                            const VkDeviceSize offset) const
+    {
+        const VkMappedMemoryRange mappedMemoryRange = GetMappedRange(allocation, size, offset);
+
+        return vkInvalidateMappedMemoryRanges(_device,
+                                              1,
+                                              &mappedMemoryRange);
+    }
+
+    void SolMemoryAllocator::Dispose()
+    {
+        for (MemoryPool& rPool : _pools)
+        {
+            for (const std::unique_ptr<MemoryBlock>& pBlock : rPool.blocks)
+            {
+                vkFreeMemory(_device, pBlock->memory, NULL);
+            }
+
+            rPool.blocks.clear();
+        }
+    }
+
+    uint32_t SolMemoryAllocator::GetOrder(const VkDeviceSize size)
+    {
+        const VkDeviceSize minBlockCount = (size + MIN_BLOCK_SIZE - 1) / MIN_BLOCK_SIZE;
+
+        // Smallest power of two number of MIN_BLOCK_SIZE's that fits
+        return static_cast<uint32_t>(std::bit_width((std::max)(minBlockCount, VkDeviceSize(1)) - 1));
+    }
+
+    bool SolMemoryAllocator::TryAllocateFromBlock(MemoryBlock& rBlock,
+                                                  const uint32_t order,
+                                                  VkDeviceSize& rOutOffset)
+    {
+        // Find the smallest free buddy that fits
+        uint32_t freeOrder = order;
+
+        while (freeOrder < rBlock.freeOffsets.size() &&
+               rBlock.freeOffsets.at(freeOrder).empty())
+        {
+            ++freeOrder;
+        }
+
+        if (freeOrder == rBlock.freeOffsets.size())
+        {
+            return false;
+        }
+
+        std::set<VkDeviceSize>& rFreeOffsets = rBlock.freeOffsets.at(freeOrder);
+
+        rOutOffset = *rFreeOffsets.begin();
+        rFreeOffsets.erase(rFreeOffsets.begin());
+
+        // Split it in half until it's the right size, freeing the upper halves
+        while (freeOrder > order)
+        {
+            --freeOrder;
+
+            rBlock.freeOffsets.at(freeOrder).insert(rOutOffset + (MIN_BLOCK_SIZE << freeOrder));
+        }
+
+        return true;
+    }
+
+    void SolMemoryAllocator::FreeToBlock(MemoryBlock& rBlock,
+                                         uint32_t order,
+                                         const uint32_t orderCount,
+                                         VkDeviceSize offset)
+    {
+        // Merge with the buddy for as long as it's free too
+        while (order + 1 < orderCount)
+        {
+            const VkDeviceSize buddyOffset = offset ^ (MIN_BLOCK_SIZE << order);
+
+            if (rBlock.freeOffsets.at(order).erase(buddyOffset) == 0)
+            {
+                break;
+            }
+
+            offset = (std::min)(offset, buddyOffset);
+            ++order;
+        }
+
+        rBlock.freeOffsets.at(order).insert(offset);
+    }
+
+    VkDeviceMemory SolMemoryAllocator::AllocateDeviceMemory(const VkDeviceSize size,
+                                                            const uint32_t memoryTypeIndex,
+                                                            void** ppMappedData)
+    {
+        const VkMemoryAllocateInfo memoryAllocateInfo
+        {
+            .sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+            .allocationSize  = size,
+            .memoryTypeIndex = memoryTypeIndex
+        };
+
+        VkDeviceMemory memory{ VK_NULL_HANDLE };
+
+        if (vkAllocateMemory(_device, &memoryAllocateInfo, NULL, &memory) != VK_SUCCESS)
+        {
+            return VK_NULL_HANDLE;
+        }
+
+        *ppMappedData = nullptr;
+
+        // Only one mapping per VkDeviceMemory is allowed, so map it once for everything sharing it
+        if (_memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+        {
+            DBG_ASSERT_VULKAN_MSG(vkMapMemory(_device, memory, 0, VK_WHOLE_SIZE, 0, ppMappedData),
+                                  "Failed to Map Memory Block.");
+        }
+
+        _allocatedBytes += size;
+        ++_blockCount;
+
+        return memory;
+    }
+
+    MemoryAllocation SolMemoryAllocator::AllocateDedicated(const VkMemoryRequirements& memoryRequirements,
+                                                           const uint32_t memoryTypeIndex)
+    {
+        MemoryAllocation allocation
+        {
+            .size  = memoryRequirements.size,
+            .order = DEDICATED_ORDER
+        };
+
+        allocation.memory = AllocateDeviceMemory(allocation.size,
+                                                 memoryTypeIndex,
+                                                 &allocation.pMappedData);
+
+        DBG_ASSERT_MSG((allocation.memory != VK_NULL_HANDLE),
+                       "Failed to Allocate Device Memory.");
+
+        _usedBytes += allocation.size;
+        ++_allocationCount;
+
+        return allocation;
+    }
+
+    SolMemoryAllocator::MemoryBlock* SolMemoryAllocator::AddBlock(MemoryPool& rPool)
+    {
+        std::unique_ptr<MemoryBlock> pBlock = std::make_unique<MemoryBlock>();
+
+        pBlock->memory = AllocateDeviceMemory(rPool.blockSize,
+                                              rPool.memoryTypeIndex,
+                                              &pBlock->pMappedData);
+
+        if (pBlock->memory == VK_NULL_HANDLE)
+        {
+            return nullptr;
+        }
+
+        // The whole block starts as one free buddy
+        pBlock->freeOffsets.resize(rPool.orderCount);
+        pBlock->freeOffsets.back().insert(0);
+
+        rPool.blocks.push_back(std::move(pBlock));
+
+        return rPool.blocks.back().get();
+    }
+
+    VkMappedMemoryRange SolMemoryAllocator::GetMappedRange(const MemoryAllocation& allocation,
+                                                           const VkDeviceSize size,
+                                                           const VkDeviceSize offset) const
+    {
+        const VkDeviceSize allocationEnd = allocation.offset + allocation.size;
+
+        VkDeviceSize rangeBegin = allocation.offset + offset;
+        VkDeviceSize rangeEnd   = (size == VK_WHOLE_SIZE) ? allocationEnd : rangeBegin + size;
+
+        // Non-coherent ranges have to cover whole atoms. Buddies are multiples of an atom,
+        // so only a dedicated allocation can round past its end, which is the end of the mapping anyway.
+        rangeBegin = (rangeBegin / _nonCoherentAtomSize) * _nonCoherentAtomSize;
+        rangeEnd   = ((rangeEnd + _nonCoherentAtomSize - 1) / _nonCoherentAtomSize) * _nonCoherentAtomSize;
+
+        return VkMappedMemoryRange
+        {
+            .sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+            .memory = allocation.memory,
+            .offset = rangeBegin,
+            .size   = (rangeEnd > allocationEnd) ? VK_WHOLE_SIZE : rangeEnd - rangeBegin
+        };
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <array>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "DebugHelpers.hpp"
+#include "IDisposable.hpp"
+#include "MemoryAllocation.hpp"
+
+using namespace SolEngine::Data;
+using namespace SolEngine::Interface;
+
+namespace SolEngine
+{
+    /// <summary>
+    /// Sub-allocates buffers and images from large blocks of device memory using a buddy scheme,
+    /// so creating a mesh doesn't cost a vkAllocateMemory. Each memory type gets its own pool of blocks,
+    /// with buffers and images kept apart so bufferImageGranularity never applies.
+    /// Host visible blocks stay mapped for their whole life. Safe to use from multiple threads.
+    /// </summary>
+    class SolMemoryAllocator : private IDisposable
+    {
+    public:
+        static constexpr uint32_t DEDICATED_ORDER{ (std::numeric_limits<uint32_t>::max)() };
+
+        SolMemoryAllocator(const VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties, const VkDeviceSize nonCoherentAtomSize);
+        ~SolMemoryAllocator();
+
+        SolMemoryAllocator(const SolMemoryAllocator&)            = delete;
+        SolMemoryAllocator& operator=(const SolMemoryAllocator&) = delete;
+
+        /// <summary>
+        /// Finds space for the requirements in the memory type's pool, adding a block if they are all full.
+        /// Requests larger than a block get a dedicated allocation.
+        /// </summary>
+        MemoryAllocation Allocate(const VkMemoryRequirements& memoryRequirements, const uint32_t memoryTypeIndex, const bool isImage);
+        void             Free(const MemoryAllocation& allocation);
+
+        VkResult Flush(const MemoryAllocation& allocation, const VkDeviceSize size = VK_WHOLE_SIZE, const VkDeviceSize offset = 0) const;
+        VkResult Invalidate(const MemoryAllocation& allocation, const VkDeviceSize size = VK_WHOLE_SIZE, const VkDeviceSize offset = 0) const;
+
+        // Occupancy
+        size_t GetAllocatedBytes()   const { return _allocatedBytes; }
+        size_t GetUsedBytes()        const { return _usedBytes; }
+        size_t GetBlockCount()       const { return _blockCount; }
+        size_t GetAllocationCount()  const { return _allocationCount; }
+
+    private:
+        static constexpr VkDeviceSize MIN_BLOCK_SIZE    { 256 };                  // Smallest buddy, no smaller than any nonCoherentAtomSize
+        static constexpr VkDeviceSize MEMORY_BLOCK_SIZE { 64 * 1024 * 1024 };     // Shrinks on small heaps
+        static constexpr uint32_t     HEAP_BLOCK_DIVISOR{ 8 };                    // A block never takes more than this fraction of its heap
+
+        struct MemoryBlock
+        {
+            VkDeviceMemory                      memory     { VK_NULL_HANDLE };
+            void*                               pMappedData{ nullptr };
+            VkDeviceSize                        usedBytes  { 0 };
+            std::vector<std::set<VkDeviceSize>> freeOffsets;                        // Free buddy offsets per order
+        };
+
+        struct MemoryPool
+        {
+            uint32_t                                  memoryTypeIndex{ 0 };
+            VkDeviceSize                              blockSize      { 0 };
+            uint32_t                                  orderCount     { 0 };
+            std::vector<std::unique_ptr<MemoryBlock>> blocks;
+        };
+
+        // Inherited via IDisposable
+        virtual void Dispose() override;
+
+        static uint32_t GetOrder(const VkDeviceSize size);
+        static bool     TryAllocateFromBlock(MemoryBlock& rBlock, const uint32_t order, VkDeviceSize& rOutOffset);
+        static void     FreeToBlock(MemoryBlock& rBlock, uint32_t order, const uint32_t orderCount, VkDeviceSize offset);
+
+        VkDeviceMemory      AllocateDeviceMemory(const VkDeviceSize size, const uint32_t memoryTypeIndex, void** ppMappedData);
+        MemoryAllocation    AllocateDedicated(const VkMemoryRequirements& memoryRequirements, const uint32_t memoryTypeIndex);
+        MemoryBlock*        AddBlock(MemoryPool& rPool);
+        VkMappedMemoryRange GetMappedRange(const MemoryAllocation& allocation, const VkDeviceSize size, const VkDeviceSize offset) const;
+
+        VkDevice                         _device;
+        VkPhysicalDeviceMemoryProperties _memoryProperties;
+        VkDeviceSize                     _nonCoherentAtomSize;
+
+        std::mutex                                      _mutex;
+        std::array<MemoryPool, VK_MAX_MEMORY_TYPES * 2> _pools;   // [memoryTypeIndex * 2 + isImage]
+
+        size_t _allocatedBytes { 0 };
+        size_t _usedBytes      { 0 };
+        size_t _blockCount     { 0 };
+        size_t _allocationCount{ 0 };
+    };
+}
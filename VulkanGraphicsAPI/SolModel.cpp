@@ -1,18 +1,42 @@
 #include "SolModel.hpp"
+#include "SolRenderer.hpp"
+#include "CellInstance.hpp"
 
 namespace SolEngine
 {
     SolModel::SolModel(SolDevice& rSolDevice, 
+                       SolRenderer& rSolRenderer,
                        const Vertex* pVertices, 
                        const uint32_t vertexCount, 
                        const UIndex_t* pIndices, 
                        const uint32_t indexCount)
-        : _rSolDevice(rSolDevice)
+        : _rSolDevice(rSolDevice),
+          _rSolRenderer(rSolRenderer)
     {
         CreateVertexBuffers(pVertices, vertexCount);
         CreateIndexBuffer(pIndices, indexCount);
     }
 
+    SolModel::SolModel(SolDevice& rSolDevice, 
+                       SolRenderer& rSolRenderer,
+                       const uint32_t vertexCapacity)
+        : _rSolDevice(rSolDevice),
+          _rSolRenderer(rSolRenderer)
+    {
+        CreateMappedVertexBuffer(vertexCapacity);
+    }
+
+    SolModel::SolModel(SolDevice& rSolDevice, 
+                       SolRenderer& rSolRenderer,
+                       const uint32_t vertexCapacity,
+                       const VkBufferUsageFlags additionalUsageFlags)
+        : _rSolDevice(rSolDevice),
+          _rSolRenderer(rSolRenderer)
+    {
+        CreateDeviceWrittenVertexBuffer(vertexCapacity, 
+                                        additionalUsageFlags);
+    }
+
     SolModel::~SolModel()
     {
         Dispose();
@@ -25,23 +49,62 @@ namespace SolEngine
 
         vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
 
+        if (_pInstanceBuffer != nullptr)
+        {
+            VkBuffer instanceBuffers[]{ _pInstanceBuffer->GetBuffer() };
+
+            vkCmdBindVertexBuffers(commandBuffer, CellInstance::BINDING, 1, instanceBuffers, offsets);
+        }
+
         if (!_hasIndexBuffer)
         {
             return;
         }
 
-        // TODO:
-        // Right now index buffers are a 32-bit number, 
-        // but since this will only be rendering cubes - 
-        // we may be able to reduce this to a smaller data type.
+        // Indices are 8-bit on the CPU, but VK_INDEX_TYPE_UINT8_EXT needs VK_EXT_index_type_uint8,
+        // so they're widened to 16-bit when uploaded
         vkCmdBindIndexBuffer(commandBuffer, 
                              _pIndexBuffer->GetBuffer(),
                              0, 
-                             VK_INDEX_TYPE_UINT8_EXT);
+                             VK_INDEX_TYPE_UINT16);
+    }
+
+    void SolModel::SetInstances(const std::shared_ptr<SolBuffer>& pInstanceBuffer, 
+                                const uint32_t instanceCount)
+    {
+        DBG_ASSERT_MSG((instanceCount == 0 || pInstanceBuffer != nullptr),
+                       "Cannot draw Instances without an Instance Buffer!");
+
+        _pInstanceBuffer = pInstanceBuffer;
+        _instanceCount   = instanceCount;
+    }
+
+    void SolModel::SetVertexCount(const uint32_t vertexCount)
+    {
+        DBG_ASSERT_MSG((_pMappedVertices != nullptr),
+                       "Cannot set the Vertex Count of a Model that isn't mapped!");
+        DBG_ASSERT_MSG((vertexCount <= _vertexCapacity),
+                       "Vertex Count exceeds the Model's capacity!");
+
+        _verticesInUseCount = vertexCount;
+
+        if (vertexCount == 0 ||
+            (_pVertexBuffer->GetMemoryPropertyFlags() & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+        {
+            return;
+        }
+
+        _pVertexBuffer->FlushBuffer(sizeof(Vertex) * vertexCount);
     }
 
     void SolModel::Draw(const VkCommandBuffer commandBuffer)
     {
+        // e.g. Instanced Cubes with no live cells
+        if (_instanceCount == 0U)
+        {
+            return;
+        }
+
         if (!_hasIndexBuffer)
         {
             vkCmdDraw(commandBuffer, 
@@ -66,12 +129,42 @@ namespace SolEngine
                          0);
     }
 
+    void SolModel::DrawIndirect(const VkCommandBuffer commandBuffer, 
+                                const VkBuffer indirectBuffer, 
+                                const VkDeviceSize offset, 
+                                const uint32_t drawCount)
+    {
+        const uint32_t stride = sizeof(VkDrawIndirectCommand);
+
+        if (_rSolDevice.GetEnabledFeatures().multiDrawIndirect)
+        {
+            vkCmdDrawIndirect(commandBuffer,
+                              indirectBuffer,
+                              offset,
+                              drawCount,
+                              stride);
+
+            return;
+        }
+
+        // Without multiDrawIndirect it's one call per draw, but the arguments still come from the buffer
+        for (uint32_t i(0); i < drawCount; ++i)
+        {
+            vkCmdDrawIndirect(commandBuffer,
+                              indirectBuffer,
+                              offset + i * stride,
+                              1,
+                              stride);
+        }
+    }
+
     void SolModel::Dispose()
     {}
 
     void SolModel::CreateVertexBuffers(const Vertex* pVertices, const uint32_t vertexCount)
     {
         _verticesInUseCount = vertexCount;
+        _vertexCapacity     = vertexCount;
 
         const size_t vertexSize = sizeof(Vertex);
         const VkDeviceSize bufferSize = vertexSize * vertexCount;
@@ -95,16 +188,6 @@ namespace SolEngine
         //   Memory directly                ==============================
         //   to Device Local Memory!         (Optimal Device Local Memory)
 
-        // Create Staging Buffer for Vertex Data
-        SolBuffer stagingBuffer(_rSolDevice, 
-                                vertexSize, 
-                                vertexCount, 
-                                VK_BUFFER_USAGE_TRANSFER_SRC_BIT, 
-                                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-        stagingBuffer.Map();
-        stagingBuffer.WriteToBuffer((void *)pVertices);
-
         // Create buffer in Device Local Memory
         _pVertexBuffer = std::make_unique<SolBuffer>(_rSolDevice,
                                                      vertexSize, 
@@ -112,10 +195,63 @@ namespace SolEngine
                                                      VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,  // Create a buffer to hold Vertex Input data
                                                      VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);                                  // Use Device Local Memory
 
-        // Copy over data in the staging buffer to device local memory...
-        _rSolDevice.CopyBuffer(stagingBuffer.GetBuffer(), 
-                               _pVertexBuffer->GetBuffer(), 
-                               bufferSize);
+        // Staged in the frame's ring and copied at the start of the next frame,
+        // rather than a temp Staging Buffer and a blocking copy per mesh
+        _rSolRenderer.UploadToBuffer(_pVertexBuffer->GetBuffer(),
+                                     pVertices,
+                                     bufferSize);
+    }
+
+    void SolModel::CreateMappedVertexBuffer(const uint32_t vertexCapacity)
+    {
+        DBG_ASSERT_MSG((vertexCapacity != 0),
+                       "Cannot create a mapped Vertex Buffer with no capacity!");
+
+        _vertexCapacity = vertexCapacity;
+
+        // On Unified Memory and ReBAR devices Device Local Memory can be mapped,
+        // so the vertices are written where the GPU reads them with no Staging Buffer or copy.
+        //   Host (CPU)              |              Device (GPU)
+        // 
+        //                   Write through
+        // ===============      mapping       ==============================
+        // | Vertex *    | -----------------> |    Vertex Buffer Memory    |
+        // ===============                    ==============================
+        //                                     (Device Local + Host Visible)
+        const std::vector<VkMemoryPropertyFlags> preferredMemoryProperties
+        {
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+        };
+
+        _pVertexBuffer = std::make_unique<SolBuffer>(_rSolDevice,
+                                                     sizeof(Vertex), 
+                                                     vertexCapacity,
+                                                     VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                                                     preferredMemoryProperties);
+
+        // Stays mapped for its whole life
+        DBG_ASSERT_VULKAN_MSG(_pVertexBuffer->Map(), 
+                              "Failed to Map Vertex Buffer.");
+
+        _pMappedVertices = static_cast<Vertex*>(_pVertexBuffer->GetMappedMemory());
+    }
+
+    void SolModel::CreateDeviceWrittenVertexBuffer(const uint32_t vertexCapacity, 
+                                                   const VkBufferUsageFlags additionalUsageFlags)
+    {
+        DBG_ASSERT_MSG((vertexCapacity != 0),
+                       "Cannot create a Vertex Buffer with no capacity!");
+
+        _vertexCapacity = vertexCapacity;
+
+        // Never touched by the CPU, the vertices are made and drawn on the GPU
+        _pVertexBuffer = std::make_unique<SolBuffer>(_rSolDevice,
+                                                     sizeof(Vertex), 
+                                                     vertexCapacity,
+                                                     VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | additionalUsageFlags,
+                                                     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
     }
 
     void SolModel::CreateIndexBuffer(const UIndex_t* pIndices, const uint32_t indexCount)
@@ -127,7 +263,10 @@ namespace SolEngine
 
         _indexCount = indexCount;
 
-        const size_t indexSize = sizeof(UIndex_t);
+        // See Bind, uploaded as the smallest index type that doesn't need an extension
+        const std::vector<uint16_t> widenedIndices(pIndices, pIndices + indexCount);
+
+        const size_t indexSize = sizeof(uint16_t);
         const VkDeviceSize bufferSize = indexSize * indexCount;
 
         // We can't directly map from Host memory to Device Local Memory
@@ -149,16 +288,6 @@ namespace SolEngine
         //   Memory directly                ==============================
         //   to Device Local Memory!         (Optimal Device Local Memory)
 
-        // Create Staging Buffer for Index Data
-        SolBuffer stagingBuffer(_rSolDevice,
-                                indexSize, 
-                                indexCount, 
-                                VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-        stagingBuffer.Map();
-        stagingBuffer.WriteToBuffer((void*)pIndices);
-
         // Create buffer in Device Local Memory
         _pIndexBuffer = std::make_unique<SolBuffer>(_rSolDevice,
                                                     indexSize, 
@@ -166,10 +295,9 @@ namespace SolEngine
                                                     VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,  // Create a buffer to hold Vertex Input data
                                                     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);                                 // Use Device Local Memory
 
-        // Copy over data in the staging buffer to device local memory...
-        _rSolDevice.CopyBuffer(stagingBuffer.GetBuffer(),
-                               _pIndexBuffer->GetBuffer(), 
-                               bufferSize);
+        _rSolRenderer.UploadToBuffer(_pIndexBuffer->GetBuffer(),
+                                     widenedIndices.data(),
+                                     bufferSize);
 
         _hasIndexBuffer = true;
     }
@@ -1,36 +1,87 @@
 #pragma once
 #include "SolBuffer.hpp"
 #include "Constants.hpp"
+#include "MeshChunk.hpp"
 
 using namespace SolEngine::Data;
 
 namespace SolEngine
 {
+    class SolRenderer;
+
     // Takes vertex data created by or read in a file on the CPU
     // Then allocate and copy the data over to the GPU to be rendered
     class SolModel : public IDisposable
     {
     public:
-        SolModel(SolDevice& rSolDevice, const Vertex* pVertices, const uint32_t vertexCount, const UIndex_t* pIndices = nullptr, const uint32_t indexCount = 0);
+        SolModel(SolDevice& rSolDevice, SolRenderer& rSolRenderer, const Vertex* pVertices, const uint32_t vertexCount, const UIndex_t* pIndices = nullptr, const uint32_t indexCount = 0);
+
+        /// <summary>
+        /// Creates an empty vertex buffer that stays mapped, so vertices can be written straight into it.
+        /// Prefers mappable Device Local Memory, falling back to Host Visible Memory on devices without it.
+        /// </summary>
+        SolModel(SolDevice& rSolDevice, SolRenderer& rSolRenderer, const uint32_t vertexCapacity);
+
+        /// <summary>
+        /// Creates an empty Device Local vertex buffer for the GPU to write vertices into, e.g. from a compute shader.
+        /// Only drawn indirectly, as the CPU never knows how many vertices were written.
+        /// </summary>
+        SolModel(SolDevice& rSolDevice, SolRenderer& rSolRenderer, const uint32_t vertexCapacity, const VkBufferUsageFlags additionalUsageFlags);
         ~SolModel();
 
+        Vertex*  GetMappedVertices() const { return _pMappedVertices; }
+        uint32_t GetVertexCapacity() const { return _vertexCapacity; }
+
+        VkDescriptorBufferInfo GetVertexBufferInfo() const { return _pVertexBuffer->DescriptorBufferInfo(); }
+
+        /// <summary>
+        /// Sets how many of the mapped vertices get drawn, flushing them if the memory isn't coherent.
+        /// </summary>
+        void SetVertexCount(const uint32_t vertexCount);
+
+        /// <summary>
+        /// Splits the vertices into chunks that can be drawn, or culled, on their own.
+        /// </summary>
+        void                          SetChunks(const std::vector<MeshChunk>& chunks) { _chunks = chunks; }
+        const std::vector<MeshChunk>& GetChunks() const                               { return _chunks; }
+
+        /// <summary>
+        /// Draws the model once per instance, reading the instance's data from the buffer's CellInstance binding.
+        /// The model shares the buffer, so it can be swapped or regrown without rebuilding the model.
+        /// </summary>
+        void SetInstances(const std::shared_ptr<SolBuffer>& pInstanceBuffer, const uint32_t instanceCount);
+
         void Bind(const VkCommandBuffer commandBuffer);
         void Draw(const VkCommandBuffer commandBuffer);
 
+        /// <summary>
+        /// Draws with arguments the GPU reads from the buffer, one VkDrawIndirectCommand per draw.
+        /// </summary>
+        void DrawIndirect(const VkCommandBuffer commandBuffer, const VkBuffer indirectBuffer, const VkDeviceSize offset, const uint32_t drawCount);
+
         // Inherited via IDisposable
         virtual void Dispose() override;
         
     private:
         void CreateVertexBuffers(const Vertex* pVertices, const uint32_t vertexCount);
+        void CreateMappedVertexBuffer(const uint32_t vertexCapacity);
+        void CreateDeviceWrittenVertexBuffer(const uint32_t vertexCapacity, const VkBufferUsageFlags additionalUsageFlags);
         void CreateIndexBuffer(const UIndex_t* pIndices, const uint32_t indexCount = 0);
 
-        SolDevice& _rSolDevice;
+        SolDevice&   _rSolDevice;
+        SolRenderer& _rSolRenderer;
 
         bool _hasIndexBuffer{ false };
         std::unique_ptr<SolBuffer> _pVertexBuffer;
         std::unique_ptr<SolBuffer> _pIndexBuffer;
+        std::shared_ptr<SolBuffer> _pInstanceBuffer;
+
+        Vertex*  _pMappedVertices{ nullptr };
+
+        std::vector<MeshChunk> _chunks;
 
         uint32_t _verticesInUseCount{ 0 };
+        uint32_t _vertexCapacity{ 0 };
         uint32_t _indexCount{ 0 };
         uint32_t _instanceCount{ 1U };
     };
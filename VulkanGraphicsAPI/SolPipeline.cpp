@@ -3,10 +3,12 @@
 namespace SolEngine
 {
     SolPipeline::SolPipeline(SolDevice& rSolDevice, 
+                             SolShaderLibrary& rSolShaderLibrary,
                              const std::string& vertShaderFilePath, 
                              const std::string& fragShaderFilePath, 
                              const PipelineConfigInfo& configInfo)
-        : _rSolDevice(rSolDevice)
+        : _rSolDevice(rSolDevice),
+          _rSolShaderLibrary(rSolShaderLibrary)
     {
         CreateGraphicsPipeline(vertShaderFilePath, 
                                fragShaderFilePath, 
@@ -122,7 +124,9 @@ namespace SolEngine
             {
                 .sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
                 .flags = NULL
-            }
+            },
+            .inputBindingDescriptions   = Vertex::InputBindingDescriptors(),
+            .inputAttributeDescriptions = Vertex::InputAttributeDescriptions()
         };
 
         // We have to set these afterwards or else they will be <???>
@@ -134,43 +138,12 @@ namespace SolEngine
 
     void SolPipeline::Dispose()
     {
-        const VkDevice& device = _rSolDevice.GetDevice();
-
-        vkDestroyShaderModule(device, 
-                              _vertexShaderModule, 
-                              NULL);
-
-        vkDestroyShaderModule(device, 
-                              _fragmentShaderModule,
-                              NULL);
-
-        vkDestroyPipeline(device, 
+        // Shader modules belong to the shader library
+        vkDestroyPipeline(_rSolDevice.GetDevice(), 
                           _graphicsPipeline, 
                           NULL);
     }
 
-    std::vector<char> SolPipeline::ReadFile(const std::string& filePath)
-    {
-        const std::string openFileFailedMessage = "Failed to open file: " + filePath;
-
-        // ate = seek to the end of the open file immediately.
-        // binary = read file in as a binary.
-        std::ifstream file(filePath,
-                           std::ios::ate | std::ios::binary);
-
-        DBG_ASSERT_MSG(file.is_open(), openFileFailedMessage.c_str());
-
-        const size_t fileSize = static_cast<size_t>(file.tellg());
-        std::vector<char> fileBuffer(fileSize);
-
-        // Read from file into buffer
-        file.seekg(0);
-        file.read(fileBuffer.data(), fileSize);
-        file.close();
-
-        return fileBuffer;
-    }
-
     void SolPipeline::CreateGraphicsPipeline(const std::string& vertShaderFilePath, 
                                              const std::string& fragShaderFilePath, 
                                              const PipelineConfigInfo& configInfo)
@@ -182,13 +155,11 @@ namespace SolEngine
         DBG_ASSERT_MSG((configInfo.renderPass != VK_NULL_HANDLE),
                        "Cannot create Graphics pipeline:: No renderPass provided in configInfo!");
 
-        const std::vector<char> vertexShaderCode = ReadFile(vertShaderFilePath);
-        const std::vector<char> fragShaderCode = ReadFile(fragShaderFilePath);
+        // Loaded once and shared with every other pipeline using the same shaders
+        const VkShaderModule vertexShaderModule   = _rSolShaderLibrary.GetShaderModule(vertShaderFilePath);
+        const VkShaderModule fragmentShaderModule = _rSolShaderLibrary.GetShaderModule(fragShaderFilePath);
         const char *shaderStageName = "main";
 
-        CreateShaderModule(vertexShaderCode, &_vertexShaderModule);
-        CreateShaderModule(fragShaderCode, &_fragmentShaderModule);
-
         const std::array<VkPipelineShaderStageCreateInfo, 2> shaderStageCreateInfos
         {
             // Vertex Shader
@@ -198,7 +169,7 @@ namespace SolEngine
                 .pNext               = NULL,
                 .flags               = 0,
                 .stage               = VK_SHADER_STAGE_VERTEX_BIT,
-                .module              = _vertexShaderModule,
+                .module              = vertexShaderModule,
                 .pName               = shaderStageName,
                 .pSpecializationInfo = NULL             // Customise Shader functionality
             },
@@ -209,14 +180,14 @@ namespace SolEngine
                 .pNext               = NULL,
                 .flags               = 0,
                 .stage               = VK_SHADER_STAGE_FRAGMENT_BIT,
-                .module              = _fragmentShaderModule,
+                .module              = fragmentShaderModule,
                 .pName               = shaderStageName,
                 .pSpecializationInfo = NULL             // Customise Shader functionality
             }
         };
 
-        const std::vector<VkVertexInputBindingDescription> inputBindingDescriptions     = Vertex::InputBindingDescriptors();
-        const std::vector<VkVertexInputAttributeDescription> inputAttributeDescriptions = Vertex::InputAttributeDescriptions();
+        const std::vector<VkVertexInputBindingDescription>&   inputBindingDescriptions   = configInfo.inputBindingDescriptions;
+        const std::vector<VkVertexInputAttributeDescription>& inputAttributeDescriptions = configInfo.inputAttributeDescriptions;
 
         // Describe how to interpret Vertex Buffer data
         // that is the initial input into the Graphics Pipeline
@@ -250,7 +221,7 @@ namespace SolEngine
         };
 
         const VkResult result = vkCreateGraphicsPipelines(_rSolDevice.GetDevice(), 
-                                                          VK_NULL_HANDLE, 
+                                                          _rSolDevice.GetPipelineCache(), 
                                                           1,
                                                           &graphicsPipelineCreateInfo, 
                                                           NULL, 
@@ -258,22 +229,4 @@ namespace SolEngine
 
         DBG_ASSERT_VULKAN_MSG(result, "Failed to Create Graphics Pipeline.");
     }
-
-    void SolPipeline::CreateShaderModule(const std::vector<char>& shaderCode, 
-                                         VkShaderModule* pOutShaderModule)
-    {
-        const VkShaderModuleCreateInfo shaderModuleCreateInfo
-        {
-            .sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
-            .codeSize = shaderCode.size(),
-            .pCode    = reinterpret_cast<const uint32_t*>(shaderCode.data())
-        };
-
-        const VkResult result = vkCreateShaderModule(_rSolDevice.GetDevice(), 
-                                                     &shaderModuleCreateInfo, 
-                                                     NULL, 
-                                                     pOutShaderModule);
-
-        DBG_ASSERT_VULKAN_MSG(result, "Failed to Create Shader Module.");
-    }
 }
\ No newline at end of file
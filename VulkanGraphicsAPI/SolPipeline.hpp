@@ -4,6 +4,7 @@
 
 #include "PipelineConfigInfo.hpp"
 #include "SolDevice.hpp"
+#include "SolShaderLibrary.hpp"
 #include "Vertex.hpp"
 
 using namespace SolEngine::Data;
@@ -14,7 +15,7 @@ namespace SolEngine
     {
     public:
         SolPipeline() = default;
-        SolPipeline(SolDevice& rSolDevice, const std::string& vertShaderFilePath, 
+        SolPipeline(SolDevice& rSolDevice, SolShaderLibrary& rSolShaderLibrary, const std::string& vertShaderFilePath, 
                     const std::string& fragShaderFilePath, const PipelineConfigInfo& configInfo);
         ~SolPipeline();
 
@@ -24,16 +25,11 @@ namespace SolEngine
         // Inherited via IDisposable
         virtual void Dispose() override;
     private:
-        static std::vector<char> ReadFile(const std::string& filePath);
-
         void CreateGraphicsPipeline(const std::string& vertShaderFilePath, const std::string& fragShaderFilePath, const PipelineConfigInfo& configInfo);
-        void CreateShaderModule(const std::vector<char>& shaderCode, VkShaderModule* pOutShaderModule);
 
-        SolDevice& _rSolDevice;
+        SolDevice&        _rSolDevice;
+        SolShaderLibrary& _rSolShaderLibrary;
         
         VkPipeline _graphicsPipeline;
-
-        VkShaderModule _vertexShaderModule;
-        VkShaderModule _fragmentShaderModule;
     };
 }
@@ -11,6 +11,8 @@ namespace SolEngine
 	{
         RecreateSwapchain();
         CreateCommandBuffers();
+        CreateSecondaryCommandPools();
+        CreateFrameDescriptorPools();
     }
 
     SolRenderer::~SolRenderer()
@@ -23,15 +25,199 @@ namespace SolEngine
         DBG_ASSERT_MSG(_isFrameStarted,
                        "Cannot get Command Buffer when frame is not in progress!");
 
-        return _commandBuffers.at(_currentFrameIndex);
+        return _frames[_currentFrameIndex].commandBuffer;
     }
 
-    size_t SolRenderer::GetFrameIndex() const
+    void SolRenderer::SetFramesInFlight(const uint32_t framesInFlight)
+    {
+        const uint32_t clampedFramesInFlight = std::clamp(framesInFlight, 
+                                                          SolSwapchain::MIN_FRAMES_IN_FLIGHT, 
+                                                          SolSwapchain::MAX_FRAMES_IN_FLIGHT);
+
+        if (clampedFramesInFlight == _framesInFlight)
+        {
+            return;
+        }
+
+        DBG_ASSERT_MSG(!_isFrameStarted,
+                       "Cannot change Frames In Flight while frame is in progress!");
+
+        // Every frame has to finish before the ring can be resized
+        vkDeviceWaitIdle(_rSolDevice.GetDevice());
+
+        _completedFrameCount = _submittedFrameCount;
+
+        // Anything already staged for the upcoming frame has to stay with it
+        if (_currentFrameIndex >= clampedFramesInFlight)
+        {
+            std::swap(_frames[_currentFrameIndex], _frames[0]);
+
+            _currentFrameIndex = 0;
+        }
+
+        _framesInFlight = clampedFramesInFlight;
+    }
+
+    StagingAllocation SolRenderer::AllocateStagingMemory(const VkDeviceSize size, 
+                                                         const VkDeviceSize alignment)
+    {
+        FrameResources& rFrame = PrepareFrameResources();
+
+        VkDeviceSize offset = (rFrame.stagingOffset + alignment - 1) & ~(alignment - 1);
+
+        if (rFrame.pStagingBuffer == nullptr || 
+            offset + size > rFrame.pStagingBuffer->GetBufferSize())
+        {
+            const VkDeviceSize currentSize = (rFrame.pStagingBuffer != nullptr) ? rFrame.pStagingBuffer->GetBufferSize() : 0;
+
+            // Anything already staged this frame still needs the old buffer until the GPU is done with it
+            if (rFrame.pStagingBuffer != nullptr)
+            {
+                rFrame.deferredReleases.push_back(rFrame.pStagingBuffer);
+            }
+
+            CreateStagingBuffer(rFrame, 
+                                (std::max)({ FRAME_STAGING_BUFFER_SIZE, currentSize * 2, size }));
+
+            offset = 0;
+        }
+
+        rFrame.stagingOffset = offset + size;
+
+        return StagingAllocation
+        {
+            .buffer      = rFrame.pStagingBuffer->GetBuffer(),
+            .offset      = offset,
+            .pMappedData = static_cast<uint8_t*>(rFrame.pStagingBuffer->GetMappedMemory()) + offset
+        };
+    }
+
+    void SolRenderer::UploadToBuffer(const VkBuffer dstBuffer, 
+                                     const void* pData, 
+                                     const VkDeviceSize size, 
+                                     const VkDeviceSize dstOffset)
+    {
+        // Copies can't be recorded inside the render pass
+        DBG_ASSERT_MSG(!_isFrameStarted,
+                       "Cannot upload to a Buffer while frame is in progress!");
+
+        if (size == 0)
+        {
+            return;
+        }
+
+        const StagingAllocation staging = AllocateStagingMemory(size);
+
+        std::memcpy(staging.pMappedData, pData, size);
+
+        _frames[_currentFrameIndex].uploads.push_back(BufferUpload
+        {
+            .srcBuffer = staging.buffer,
+            .dstBuffer = dstBuffer,
+            .region
+            {
+                .srcOffset = staging.offset,
+                .dstOffset = dstOffset,
+                .size      = size
+            }
+        });
+    }
+
+    SolDescriptorPool& SolRenderer::GetFrameDescriptorPool()
+    {
+        return *PrepareFrameResources().pDescriptorPool;
+    }
+
+    void SolRenderer::DeferRelease(std::shared_ptr<void> pResource)
+    {
+        if (pResource == nullptr)
+        {
+            return;
+        }
+
+        PrepareFrameResources().deferredReleases.push_back(std::move(pResource));
+    }
+
+    VkCommandBuffer SolRenderer::BeginSecondaryCommandBuffer(const uint32_t threadIndex)
     {
         DBG_ASSERT_MSG(_isFrameStarted,
-                       "Cannot get Frame Index when frame is not in progress!");
+                       "Cannot begin a Secondary Command Buffer when frame is not in progress!");
+        DBG_ASSERT_MSG((threadIndex < MAX_RECORDING_THREADS),
+                       "Thread index exceeds MAX_RECORDING_THREADS!");
+
+        SecondaryCommandPool& rSecondaryCommandPool = _frames[_currentFrameIndex].secondaryCommandPools.at(threadIndex);
+
+        // Only allocate when this frame has recorded more than it ever has before
+        if (rSecondaryCommandPool.commandBuffersInUseCount == rSecondaryCommandPool.commandBuffers.size())
+        {
+            const VkCommandBufferAllocateInfo commandBufferAllocateInfo
+            {
+                .sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                .commandPool        = rSecondaryCommandPool.commandPool,
+                .level              = VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+                .commandBufferCount = 1
+            };
+
+            VkCommandBuffer commandBuffer{ VK_NULL_HANDLE };
+
+            const VkResult result = vkAllocateCommandBuffers(_rSolDevice.GetDevice(),
+                                                             &commandBufferAllocateInfo,
+                                                             &commandBuffer);
+
+            DBG_ASSERT_VULKAN_MSG(result, "Failed to Allocate Secondary Command Buffer.");
+
+            rSecondaryCommandPool.commandBuffers.push_back(commandBuffer);
+        }
+
+        const VkCommandBuffer commandBuffer = rSecondaryCommandPool.commandBuffers.at(rSecondaryCommandPool.commandBuffersInUseCount++);
+
+        const VkCommandBufferInheritanceInfo commandBufferInheritanceInfo
+        {
+            .sType       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+            .renderPass  = _pSolSwapchain->GetRenderPass(),
+            .subpass     = 0,
+            .framebuffer = _pSolSwapchain->GetFramebuffer(_currentImageIndex)
+        };
+
+        const VkCommandBufferBeginInfo commandBufferBeginInfo
+        {
+            .sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+            .flags            = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+            .pInheritanceInfo = &commandBufferInheritanceInfo
+        };
+
+        const VkResult result = vkBeginCommandBuffer(commandBuffer,
+                                                     &commandBufferBeginInfo);
+
+        DBG_ASSERT_VULKAN_MSG(result, "Failed to Begin Recording Secondary Command Buffer.");
+
+        // Dynamic state isn't inherited from the primary
+        SetViewportAndScissor(commandBuffer);
+
+        return commandBuffer;
+    }
+
+    void SolRenderer::EndSecondaryCommandBuffer(const VkCommandBuffer commandBuffer)
+    {
+        const VkResult result = vkEndCommandBuffer(commandBuffer);
+
+        DBG_ASSERT_VULKAN_MSG(result, "Failed to Record Secondary Command Buffer.");
+    }
+
+    void SolRenderer::ExecuteSecondaryCommandBuffers(const VkCommandBuffer commandBuffer, 
+                                                     const std::vector<VkCommandBuffer>& secondaryCommandBuffers)
+    {
+        DBG_ASSERT_MSG((commandBuffer == GetCurrentCommandBuffer()),
+                       "Cannot execute Secondary Command Buffers on Command Buffer from a different frame!");
+
+        if (secondaryCommandBuffers.empty())
+        {
+            return;
+        }
 
-        return _currentFrameIndex;
+        vkCmdExecuteCommands(commandBuffer,
+                             static_cast<uint32_t>(secondaryCommandBuffers.size()),
+                             secondaryCommandBuffers.data());
     }
 
     VkCommandBuffer SolRenderer::BeginFrame()
@@ -40,7 +226,10 @@ namespace SolEngine
         DBG_ASSERT_MSG(!_isFrameStarted, 
                        "Cannot call BeginFrame while already in progress!");
 
-        VkResult result = _pSolSwapchain->AcquireNextImage(&_currentImageIndex);
+        FrameResources& rFrame = PrepareFrameResources();
+
+        VkResult result = _pSolSwapchain->AcquireNextImage(_currentFrameIndex, 
+                                                           &_currentImageIndex);
 
         // After window resize
         if (result == VK_ERROR_OUT_OF_DATE_KHR)
@@ -69,6 +258,8 @@ namespace SolEngine
 
         DBG_ASSERT_VULKAN_MSG(result, "Failed to Begin Recording Command Buffer.");
 
+        RecordBufferUploads(rFrame, commandBuffer);
+
         return commandBuffer;
     }
 
@@ -85,9 +276,17 @@ namespace SolEngine
         DBG_ASSERT_VULKAN_MSG(result,
                               "Failed to Record Command Buffer.");
 
-        result = _pSolSwapchain->SubmitCommandBuffers(&commandBuffer,
+        result = _pSolSwapchain->SubmitCommandBuffers(_currentFrameIndex,
+                                                      &commandBuffer,
                                                       &_currentImageIndex);
 
+        _frames[_currentFrameIndex].submittedFrameCount = ++_submittedFrameCount;
+
+        // The frame was submitted either way, so move on to the next one
+        _isFrameStarted    = false;
+        _isFramePrepared   = false;
+        _currentFrameIndex = (_currentFrameIndex + 1) % _framesInFlight;
+
         if (result == VK_ERROR_OUT_OF_DATE_KHR ||
             result == VK_SUBOPTIMAL_KHR ||
             _rSolWindow.WasWindowResized())
@@ -95,18 +294,14 @@ namespace SolEngine
             _rSolWindow.ResetWindowResizedFlag();
             RecreateSwapchain();
 
-            _isFrameStarted = false;
-
             return;
         }
 
         DBG_ASSERT_VULKAN_MSG(result, "Failed to Present Swapchain Image.");
-
-        _isFrameStarted = false;
-        _currentFrameIndex = (_currentFrameIndex + 1) % SolSwapchain::MAX_FRAMES_IN_FLIGHT;
     }
 
-    void SolRenderer::BeginSwapchainRenderPass(const VkCommandBuffer commandBuffer)
+    void SolRenderer::BeginSwapchainRenderPass(const VkCommandBuffer commandBuffer, 
+                                               const VkSubpassContents subpassContents)
     {
         // Swapchain Render Pass' require a frame in progress.
         // If a frame is started, the passed command buffer MUST be the current frame.
@@ -157,7 +352,20 @@ namespace SolEngine
 
         vkCmdBeginRenderPass(commandBuffer,
                              &renderPassBeginInfo,
-                             VK_SUBPASS_CONTENTS_INLINE);
+                             subpassContents);
+
+        // Only vkCmdExecuteCommands is allowed on the primary, the secondaries set their own
+        if (subpassContents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS)
+        {
+            return;
+        }
+
+        SetViewportAndScissor(commandBuffer);
+    }
+
+    void SolRenderer::SetViewportAndScissor(const VkCommandBuffer commandBuffer) const
+    {
+        const VkExtent2D& swapchainExtent = _pSolSwapchain->GetExtent();
 
         // Setup Viewport and Scissor
         const VkViewport viewport
@@ -196,6 +404,15 @@ namespace SolEngine
     void SolRenderer::Dispose()
 	{
         FreeCommandBuffers();
+        DestroySecondaryCommandPools();
+
+        for (FrameResources& rFrame : _frames)
+        {
+            rFrame.uploads.clear();
+            rFrame.deferredReleases.clear();
+            rFrame.pStagingBuffer  = nullptr;
+            rFrame.pDescriptorPool = nullptr;
+        }
 	}
 
 	void SolRenderer::PrintDeviceMemoryCapabilities()
@@ -251,31 +468,200 @@ namespace SolEngine
 
     void SolRenderer::CreateCommandBuffers()
     {
-        _commandBuffers.resize(SolSwapchain::MAX_FRAMES_IN_FLIGHT);
+        // Allocate for every slot so the frame count can change without touching them
+        std::array<VkCommandBuffer, SolSwapchain::MAX_FRAMES_IN_FLIGHT> commandBuffers{};
 
         const VkCommandBufferAllocateInfo commandBufferAllocateInfo
         {
             .sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
             .commandPool        = _rSolDevice.GetCommandPool(),
             .level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
-            .commandBufferCount = static_cast<uint32_t>(_commandBuffers.size())
+            .commandBufferCount = static_cast<uint32_t>(commandBuffers.size())
         };
 
         const VkResult result = vkAllocateCommandBuffers(_rSolDevice.GetDevice(),
                                                          &commandBufferAllocateInfo,
-                                                         _commandBuffers.data());
+                                                         commandBuffers.data());
 
         DBG_ASSERT_VULKAN_MSG(result, "Failed to Allocate Command Buffers.");
+
+        for (size_t i(0); i < commandBuffers.size(); ++i)
+        {
+            _frames[i].commandBuffer = commandBuffers.at(i);
+        }
     }
 
     void SolRenderer::FreeCommandBuffers()
     {
-        vkFreeCommandBuffers(_rSolDevice.GetDevice(), 
-                             _rSolDevice.GetCommandPool(),
-                             static_cast<uint32_t>(_commandBuffers.size()), 
-                             _commandBuffers.data());
+        for (FrameResources& rFrame : _frames)
+        {
+            if (rFrame.commandBuffer == VK_NULL_HANDLE)
+            {
+                continue;
+            }
+
+            vkFreeCommandBuffers(_rSolDevice.GetDevice(), 
+                                 _rSolDevice.GetCommandPool(),
+                                 1, 
+                                 &rFrame.commandBuffer);
+
+            rFrame.commandBuffer = VK_NULL_HANDLE;
+        }
+    }
+
+    void SolRenderer::CreateSecondaryCommandPools()
+    {
+        const VkCommandPoolCreateInfo commandPoolCreateInfo
+        {
+            .sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+            .flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,   // Reset as a whole once the frame is done with
+            .queueFamilyIndex = _rSolDevice.QueryPhysicalDeviceQueueFamilies().graphicsFamily
+        };
+
+        for (FrameResources& rFrame : _frames)
+        {
+            for (SecondaryCommandPool& rSecondaryCommandPool : rFrame.secondaryCommandPools)
+            {
+                const VkResult result = vkCreateCommandPool(_rSolDevice.GetDevice(),
+                                                            &commandPoolCreateInfo,
+                                                            NULL,
+                                                            &rSecondaryCommandPool.commandPool);
+
+                DBG_ASSERT_VULKAN_MSG(result, "Failed to create Secondary Command Pool.");
+            }
+        }
+    }
+
+    void SolRenderer::DestroySecondaryCommandPools()
+    {
+        for (FrameResources& rFrame : _frames)
+        {
+            for (SecondaryCommandPool& rSecondaryCommandPool : rFrame.secondaryCommandPools)
+            {
+                if (rSecondaryCommandPool.commandPool == VK_NULL_HANDLE)
+                {
+                    continue;
+                }
+
+                // Frees its command buffers too
+                vkDestroyCommandPool(_rSolDevice.GetDevice(), 
+                                     rSecondaryCommandPool.commandPool, 
+                                     NULL);
+
+                rSecondaryCommandPool.commandPool = VK_NULL_HANDLE;
+                rSecondaryCommandPool.commandBuffers.clear();
+                rSecondaryCommandPool.commandBuffersInUseCount = 0;
+            }
+        }
+    }
+
+    void SolRenderer::CreateFrameDescriptorPools()
+    {
+        for (FrameResources& rFrame : _frames)
+        {
+            rFrame.pDescriptorPool = SolDescriptorPool::Builder(_rSolDevice).SetMaxDescriptorSets(FRAME_DESCRIPTOR_COUNT)
+                                                                            .AddPoolSize(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 
+                                                                                         FRAME_DESCRIPTOR_COUNT)
+                                                                            .AddPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 
+                                                                                         FRAME_DESCRIPTOR_COUNT)
+                                                                            .Build();
+        }
+    }
 
-        _commandBuffers.clear();
+    void SolRenderer::CreateStagingBuffer(FrameResources& rFrame, 
+                                          const VkDeviceSize size)
+    {
+        rFrame.pStagingBuffer = std::make_shared<SolBuffer>(_rSolDevice,
+                                                            1,
+                                                            static_cast<uint32_t>(size),
+                                                            VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, // Draw commands are written straight into it too
+                                                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        // Stays mapped for its whole life
+        rFrame.pStagingBuffer->Map();
+    }
+
+    SolRenderer::FrameResources& SolRenderer::PrepareFrameResources()
+    {
+        FrameResources& rFrame = _frames[_currentFrameIndex];
+
+        if (_isFramePrepared)
+        {
+            return rFrame;
+        }
+
+        // The GPU is done with everything this slot held last time round
+        _pSolSwapchain->WaitForFrame(_currentFrameIndex);
+
+        _completedFrameCount = (std::max)(_completedFrameCount, rFrame.submittedFrameCount);
+
+        rFrame.stagingOffset = 0;
+        rFrame.pDescriptorPool->ResetPool();
+        rFrame.deferredReleases.clear();
+
+        // One reset per pool rather than per secondary command buffer
+        for (SecondaryCommandPool& rSecondaryCommandPool : rFrame.secondaryCommandPools)
+        {
+            if (rSecondaryCommandPool.commandBuffersInUseCount == 0)
+            {
+                continue;
+            }
+
+            vkResetCommandPool(_rSolDevice.GetDevice(), 
+                               rSecondaryCommandPool.commandPool, 
+                               0);
+
+            rSecondaryCommandPool.commandBuffersInUseCount = 0;
+        }
+
+        _isFramePrepared = true;
+
+        return rFrame;
+    }
+
+    void SolRenderer::RecordBufferUploads(FrameResources& rFrame, 
+                                          const VkCommandBuffer commandBuffer)
+    {
+        if (rFrame.uploads.empty())
+        {
+            return;
+        }
+
+        // Earlier frames may still be reading from the destinations
+        vkCmdPipelineBarrier(commandBuffer,
+                             VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0,
+                             0, NULL,
+                             0, NULL,
+                             0, NULL);
+
+        for (const BufferUpload& upload : rFrame.uploads)
+        {
+            vkCmdCopyBuffer(commandBuffer, 
+                            upload.srcBuffer, 
+                            upload.dstBuffer, 
+                            1, 
+                            &upload.region);
+        }
+
+        // Make the copies visible to this frame's draws
+        const VkMemoryBarrier memoryBarrier
+        {
+            .sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT
+        };
+
+        vkCmdPipelineBarrier(commandBuffer,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+                             0,
+                             1, &memoryBarrier,
+                             0, NULL,
+                             0, NULL);
+
+        rFrame.uploads.clear();
     }
 
     void SolRenderer::RecreateSwapchain()
@@ -295,6 +681,8 @@ namespace SolEngine
         // before creating a new one.
         vkDeviceWaitIdle(_rSolDevice.GetDevice());
 
+        _completedFrameCount = _submittedFrameCount;
+
         // Check if there's an old Swapchain to be passed
         if (_pSolSwapchain == nullptr)
         {
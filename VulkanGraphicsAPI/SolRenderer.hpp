@@ -1,9 +1,15 @@
 #pragma once
+#include <algorithm>
+#include <cstring>
 #include "SolWindow.hpp"
 #include "SolSwapchain.hpp"
 #include "SolModel.hpp"
+#include "SolFrameRing.hpp"
+#include "SolDescriptorPool.hpp"
+#include "StagingAllocation.hpp"
 
 using namespace SolEngine::Data;
+using namespace SolEngine::Descriptors;
 using namespace SolEngine::Interface;
 
 namespace SolEngine
@@ -11,6 +17,8 @@ namespace SolEngine
 	class SolRenderer : public IDisposable
 	{
 	public:
+        static constexpr uint32_t MAX_RECORDING_THREADS{ 8U };
+
 		SolRenderer() = delete;
 		SolRenderer(const ApplicationData& appData, SolWindow& rSolWindow, SolDevice& rSolDevice);
         ~SolRenderer();
@@ -19,8 +27,65 @@ namespace SolEngine
 
         VkRenderPass    GetSwapchainRenderPass()  const { return _pSolSwapchain->GetRenderPass(); }
         VkCommandBuffer GetCurrentCommandBuffer() const;
-        size_t          GetFrameIndex()           const;
+        size_t          GetFrameIndex()           const { return _currentFrameIndex; }
+        uint32_t        GetFramesInFlight()       const { return _framesInFlight; }
         float           GetAspectRatio()          const { return _pSolSwapchain->GetExtentAspectRatio(); }
+        glm::uvec2      GetExtentDimensions()     const { return _pSolSwapchain->GetExtentDimensions(); }
+
+        /// <summary>
+        /// Frames are numbered from 0 as they're submitted, so this is the upcoming frame's number.
+        /// </summary>
+        uint64_t GetFrameNumber() const { return _submittedFrameCount; }
+
+        /// <summary>
+        /// Every frame numbered below this has finished on the GPU.
+        /// Catches up whenever a frame's resources are recycled, so it can lag behind the GPU.
+        /// </summary>
+        uint64_t GetCompletedFrameCount() const { return _completedFrameCount; }
+
+        /// <summary>
+        /// Waits for the GPU to go idle, then cycles through the given number of frames.
+        /// More frames lets the CPU run further ahead of the GPU at the cost of latency.
+        /// </summary>
+        /// <param name="framesInFlight">Clamped to [MIN_FRAMES_IN_FLIGHT, MAX_FRAMES_IN_FLIGHT]</param>
+        void SetFramesInFlight(const uint32_t framesInFlight);
+
+        /// <summary>
+        /// Sub-allocates host visible memory that lives until the GPU has finished the upcoming frame.
+        /// Anything copied at the start of the frame has to be staged before BeginFrame,
+        /// but memory the frame reads directly, e.g. draw commands, can be allocated during it.
+        /// </summary>
+        StagingAllocation AllocateStagingMemory(const VkDeviceSize size, const VkDeviceSize alignment = STAGING_ALIGNMENT);
+
+        /// <summary>
+        /// Stages the data and records the copy at the start of the upcoming frame,
+        /// so the buffer is ready for its draws without stalling the queue.
+        /// </summary>
+        void UploadToBuffer(const VkBuffer dstBuffer, const void* pData, const VkDeviceSize size, const VkDeviceSize dstOffset = 0);
+
+        /// <summary>
+        /// Descriptor sets allocated from this pool are freed once the GPU has finished the upcoming frame.
+        /// </summary>
+        SolDescriptorPool& GetFrameDescriptorPool();
+
+        /// <summary>
+        /// Keeps the resource alive until no frame in flight can still be using it.
+        /// </summary>
+        void DeferRelease(std::shared_ptr<void> pResource);
+
+        /// <summary>
+        /// Begins a secondary command buffer that continues the swapchain render pass, with the Viewport and Scissor set.
+        /// Each thread must pass its own index, as a command pool can only be used by one thread at a time.
+        /// </summary>
+        /// <param name="threadIndex">[0, MAX_RECORDING_THREADS)</param>
+        VkCommandBuffer BeginSecondaryCommandBuffer(const uint32_t threadIndex);
+        void            EndSecondaryCommandBuffer(const VkCommandBuffer commandBuffer);
+
+        /// <summary>
+        /// Executes the secondary command buffers in order.
+        /// The render pass must have begun with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS.
+        /// </summary>
+        void ExecuteSecondaryCommandBuffers(const VkCommandBuffer commandBuffer, const std::vector<VkCommandBuffer>& secondaryCommandBuffers);
         
 
         /// <summary>
@@ -37,10 +102,10 @@ namespace SolEngine
 
         /// <summary>
         /// Called after BeginFrame to begin the Swapchain's Render pass.
-        /// Sets the Viewport and Scissor to the Command Buffer.
+        /// Sets the Viewport and Scissor to the Command Buffer, unless its contents are recorded in secondary command buffers.
         /// </summary>
         /// <param name="commandBuffer"></param>
-        void BeginSwapchainRenderPass(const VkCommandBuffer commandBuffer);
+        void BeginSwapchainRenderPass(const VkCommandBuffer commandBuffer, const VkSubpassContents subpassContents = VK_SUBPASS_CONTENTS_INLINE);
 
         /// <summary>
         /// Called before EndFrame.
@@ -52,16 +117,63 @@ namespace SolEngine
         virtual void Dispose() override;
 
 	private:
+        static constexpr VkDeviceSize STAGING_ALIGNMENT        { 16 };
+        static constexpr VkDeviceSize FRAME_STAGING_BUFFER_SIZE{ 4 * 1024 * 1024 };    // Grows if a frame needs more
+        static constexpr uint32_t     FRAME_DESCRIPTOR_COUNT   { 64 };
+
+        struct BufferUpload
+        {
+            VkBuffer     srcBuffer;
+            VkBuffer     dstBuffer;
+            VkBufferCopy region;
+        };
+
+        struct SecondaryCommandPool
+        {
+            VkCommandPool                commandPool{ VK_NULL_HANDLE };
+            std::vector<VkCommandBuffer> commandBuffers;                 // Reused each time the frame comes round
+            size_t                       commandBuffersInUseCount{ 0 };
+        };
+
+        struct FrameResources
+        {
+            VkCommandBuffer                    commandBuffer{ VK_NULL_HANDLE };
+            std::shared_ptr<SolBuffer>         pStagingBuffer;
+            VkDeviceSize                       stagingOffset{ 0 };
+            std::vector<BufferUpload>          uploads;
+            std::unique_ptr<SolDescriptorPool> pDescriptorPool;
+            std::vector<std::shared_ptr<void>> deferredReleases;
+            uint64_t                           submittedFrameCount{ 0 };  // Completed frame count once this slot finishes
+
+            std::array<SecondaryCommandPool, MAX_RECORDING_THREADS> secondaryCommandPools;    // One per recording thread
+        };
+
         void PrintDeviceMemoryCapabilities();
 
         void CreateCommandBuffers();
         void FreeCommandBuffers();
+        void CreateSecondaryCommandPools();
+        void DestroySecondaryCommandPools();
+        void CreateFrameDescriptorPools();
+        void CreateStagingBuffer(FrameResources& rFrame, const VkDeviceSize size);
+
+        /// <summary>
+        /// Waits on the upcoming frame's fence the first time it is needed,
+        /// then recycles everything the GPU was holding onto from the last time it was used.
+        /// </summary>
+        FrameResources& PrepareFrameResources();
+        void            RecordBufferUploads(FrameResources& rFrame, const VkCommandBuffer commandBuffer);
+
+        void SetViewportAndScissor(const VkCommandBuffer commandBuffer) const;
 
         void RecreateSwapchain();
 
         uint32_t _physDeviceCount{ 0 }, _physDeviceQueueFamilyCount{ 0 };
         uint32_t _currentImageIndex{ 0 }, _currentFrameIndex{ 0 };
+        uint32_t _framesInFlight{ 2 };
         bool     _isFrameStarted{ false };
+        bool     _isFramePrepared{ false };
+        uint64_t _submittedFrameCount{ 0 }, _completedFrameCount{ 0 };
 
         ApplicationData _appData;
 
@@ -69,6 +181,6 @@ namespace SolEngine
         SolDevice& _rSolDevice;
         std::unique_ptr<SolSwapchain> _pSolSwapchain;
 
-        std::vector<VkCommandBuffer> _commandBuffers;
+        SolFrameRing<FrameResources> _frames;
 	};
 }
@@ -0,0 +1,196 @@
+#include "SolShaderLibrary.hpp"
+
+namespace SolEngine
+{
+    SolShaderLibrary::SolShaderLibrary(SolDevice& rSolDevice)
+        : _rSolDevice(rSolDevice)
+    {}
+
+    SolShaderLibrary::~SolShaderLibrary()
+    {
+        Dispose();
+    }
+
+    VkShaderModule SolShaderLibrary::GetShaderModule(const std::string& filePath)
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+
+        auto shaderFileIt = _shaderFiles.find(filePath);
+
+        if (shaderFileIt == _shaderFiles.end())
+        {
+            ShaderFile shaderFile{};
+
+            const bool isShaderFileLoaded = LoadShaderFile(filePath, shaderFile);
+            const std::string loadFailedMessage = "Failed to load shader: " + filePath;
+
+            DBG_ASSERT_MSG(isShaderFileLoaded, loadFailedMessage.c_str());
+
+            if (!isShaderFileLoaded)
+            {
+                return VK_NULL_HANDLE;
+            }
+
+            shaderFileIt = _shaderFiles.emplace(filePath, shaderFile).first;
+        }
+
+        return _shaderModules.at(shaderFileIt->second.contentHash).module;
+    }
+
+    bool SolShaderLibrary::ReloadChangedShaders(std::vector<VkShaderModule>& rOutStaleModules)
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+
+        bool isAnyShaderReloaded(false);
+
+        for (auto& [filePath, rShaderFile] : _shaderFiles)
+        {
+            std::error_code errorCode{};
+            const std::filesystem::file_time_type lastWriteTime = std::filesystem::last_write_time(filePath, errorCode);
+
+            // Missing or mid-write files are picked up next time round
+            if (errorCode || lastWriteTime == rShaderFile.lastWriteTime)
+            {
+                continue;
+            }
+
+            ShaderFile reloadedShaderFile{};
+
+            if (!LoadShaderFile(filePath, reloadedShaderFile))
+            {
+                continue;
+            }
+
+            // Touched but not actually changed, so nothing to rebuild
+            const bool isContentChanged = reloadedShaderFile.contentHash != rShaderFile.contentHash;
+
+            ReleaseShaderModule(rShaderFile.contentHash, 
+                                rOutStaleModules);
+            rShaderFile = reloadedShaderFile;
+
+            if (isContentChanged)
+            {
+                printf_s("Reloaded shader: %s\n", filePath.c_str());
+
+                isAnyShaderReloaded = true;
+            }
+        }
+
+        return isAnyShaderReloaded;
+    }
+
+    void SolShaderLibrary::DestroyShaderModules(const std::vector<VkShaderModule>& shaderModules)
+    {
+        for (const VkShaderModule shaderModule : shaderModules)
+        {
+            vkDestroyShaderModule(_rSolDevice.GetDevice(), 
+                                  shaderModule, 
+                                  NULL);
+        }
+    }
+
+    void SolShaderLibrary::Dispose()
+    {
+        for (const auto& [contentHash, shaderModule] : _shaderModules)
+        {
+            vkDestroyShaderModule(_rSolDevice.GetDevice(), 
+                                  shaderModule.module, 
+                                  NULL);
+        }
+
+        _shaderModules.clear();
+        _shaderFiles.clear();
+    }
+
+    uint64_t SolShaderLibrary::HashContents(const uint8_t* pData, 
+                                            const size_t sizeBytes)
+    {
+        static constexpr uint64_t FNV_OFFSET_BASIS{ 14695981039346656037ULL };
+        static constexpr uint64_t FNV_PRIME       { 1099511628211ULL };
+
+        uint64_t hash(FNV_OFFSET_BASIS);
+
+        for (size_t i = 0; i < sizeBytes; ++i)
+        {
+            hash ^= pData[i];
+            hash *= FNV_PRIME;
+        }
+
+        return hash;
+    }
+
+    bool SolShaderLibrary::LoadShaderFile(const std::string& filePath, 
+                                          ShaderFile& rOutShaderFile)
+    {
+        std::error_code errorCode{};
+
+        // Grab the time first, so a write landing mid-load is seen as a change next time
+        rOutShaderFile.lastWriteTime = std::filesystem::last_write_time(filePath, errorCode);
+
+        const SolMappedFile shaderFile(filePath);
+
+        // Reject anything that isn't whole SPIR-V, e.g. a file still being written by the shader compiler
+        if (!shaderFile.IsValid() || 
+            shaderFile.GetSize() % sizeof(uint32_t) != 0U ||
+            *reinterpret_cast<const uint32_t*>(shaderFile.GetData()) != SPIRV_MAGIC_NUMBER)
+        {
+            return false;
+        }
+
+        rOutShaderFile.contentHash = HashContents(shaderFile.GetData(), shaderFile.GetSize());
+
+        // Same code is already loaded, possibly under another path
+        auto shaderModuleIt = _shaderModules.find(rOutShaderFile.contentHash);
+
+        if (shaderModuleIt != _shaderModules.end())
+        {
+            ++shaderModuleIt->second.fileCount;
+
+            return true;
+        }
+
+        // Mapped views are page aligned, which satisfies pCode's 4 byte alignment
+        const VkShaderModuleCreateInfo shaderModuleCreateInfo
+        {
+            .sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+            .codeSize = shaderFile.GetSize(),
+            .pCode    = reinterpret_cast<const uint32_t*>(shaderFile.GetData())
+        };
+
+        ShaderModule shaderModule{ VK_NULL_HANDLE, 1U };
+
+        const VkResult result = vkCreateShaderModule(_rSolDevice.GetDevice(), 
+                                                     &shaderModuleCreateInfo, 
+                                                     NULL, 
+                                                     &shaderModule.module);
+
+        DBG_ASSERT_VULKAN_MSG(result, "Failed to Create Shader Module.");
+
+        if (result != VK_SUCCESS)
+        {
+            return false;
+        }
+
+        _shaderModules.emplace(rOutShaderFile.contentHash, shaderModule);
+
+        return true;
+    }
+
+    void SolShaderLibrary::ReleaseShaderModule(const uint64_t contentHash, 
+                                               std::vector<VkShaderModule>& rOutStaleModules)
+    {
+        auto shaderModuleIt = _shaderModules.find(contentHash);
+
+        if (shaderModuleIt == _shaderModules.end() || 
+            --shaderModuleIt->second.fileCount > 0U)
+        {
+            return;
+        }
+
+        // Pipelines already built from the module don't need it to stay alive, 
+        // but the render system's background builds may still be using it
+        rOutStaleModules.push_back(shaderModuleIt->second.module);
+
+        _shaderModules.erase(shaderModuleIt);
+    }
+}
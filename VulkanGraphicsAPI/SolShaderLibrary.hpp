@@ -0,0 +1,75 @@
+#pragma once
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+
+#include "SolDevice.hpp"
+#include "SolMappedFile.hpp"
+
+namespace SolEngine
+{
+    /// <summary>
+    /// Loads each SPIR-V file once and shares its VkShaderModule between every pipeline that uses it.
+    /// Modules are keyed by file path, and files with identical contents share a single module.
+    /// Safe to use from multiple threads.
+    /// </summary>
+    class SolShaderLibrary : private IDisposable
+    {
+    public:
+        SolShaderLibrary(SolDevice& rSolDevice);
+        ~SolShaderLibrary();
+
+        SolShaderLibrary(const SolShaderLibrary&)            = delete;
+        SolShaderLibrary& operator=(const SolShaderLibrary&) = delete;
+
+        /// <summary>
+        /// Returns the module for a SPIR-V file, loading it on first use.
+        /// </summary>
+        VkShaderModule GetShaderModule(const std::string& filePath);
+
+        /// <summary>
+        /// Reloads any shader whose file has been modified since it was loaded.
+        /// Pipelines keep the code they were built with, so they need rebuilding to pick up the changes.
+        /// Replaced modules are handed back rather than destroyed, as pipelines may still be being built from them.
+        /// </summary>
+        /// <returns>True if any module was replaced.</returns>
+        bool ReloadChangedShaders(std::vector<VkShaderModule>& rOutStaleModules);
+
+        /// <summary>
+        /// Destroys the modules ReloadChangedShaders handed back, once nothing can be building pipelines from them.
+        /// </summary>
+        void DestroyShaderModules(const std::vector<VkShaderModule>& shaderModules);
+
+    private:
+        static constexpr uint32_t SPIRV_MAGIC_NUMBER{ 0x07230203 };
+
+        struct ShaderFile
+        {
+            uint64_t                        contentHash;
+            std::filesystem::file_time_type lastWriteTime;
+        };
+
+        struct ShaderModule
+        {
+            VkShaderModule module;
+            uint32_t       fileCount;  // Number of paths with this content
+        };
+
+        // Inherited via IDisposable
+        virtual void Dispose() override;
+
+        /// <summary>
+        /// FNV-1a, only used to spot duplicate and unchanged files.
+        /// </summary>
+        static uint64_t HashContents(const uint8_t* pData, const size_t sizeBytes);
+
+        bool LoadShaderFile(const std::string& filePath, ShaderFile& rOutShaderFile);
+        void ReleaseShaderModule(const uint64_t contentHash, std::vector<VkShaderModule>& rOutStaleModules);
+
+        SolDevice& _rSolDevice;
+
+        std::mutex                                    _mutex;
+        std::unordered_map<std::string, ShaderFile>   _shaderFiles;      // Path -> Contents
+        std::unordered_map<uint64_t, ShaderModule>    _shaderModules;    // Contents -> Module
+    };
+}
@@ -71,13 +71,8 @@ namespace SolEngine
                                    _depthImageViews.at(i),
                                    NULL);
 
-                vkDestroyImage(vkDevice,
-                               _depthImages.at(i),
-                               NULL);
-
-                vkFreeMemory(vkDevice, 
-                             _depthImageMemories.at(i),
-                             NULL);
+                _rSolDevice.DisposeImage(_depthImages.at(i),
+                                         _depthImageMemories.at(i));
             }
 
             _depthImageViews.clear();
@@ -557,50 +552,45 @@ namespace SolEngine
                                                _depthFormatFeatureFlags);
     }
 
-    VkResult SolSwapchain::AcquireNextImage(uint32_t *pImageIndex)
+    void SolSwapchain::WaitForFrame(const size_t frameIndex)
     {
-        const VkDevice &device = _rSolDevice.GetDevice();
-        const uint32_t fenceCount(1);
-
-        VkResult result = vkWaitForFences(device, 
-                                          fenceCount, 
-                                          &_inFlightFences.at(_currentFrame), 
-                                          VK_TRUE, 
-                                          _timeoutDuration);
+        WaitForFence(_inFlightFences.at(frameIndex));
+    }
 
-        DBG_ASSERT_VULKAN_MSG(result, "Wait For Fences Failed.");
+    VkResult SolSwapchain::AcquireNextImage(const size_t frameIndex, 
+                                            uint32_t *pImageIndex)
+    {
+        WaitForFrame(frameIndex);
 
-        result = vkAcquireNextImageKHR(device, 
-                                       _swapchain,
-                                       _timeoutDuration, 
-                                       _imageAvailableSemaphores.at(_currentFrame),   // Must be a non-signaled semaphore
-                                       VK_NULL_HANDLE, 
-                                       pImageIndex);
+        const VkResult result = vkAcquireNextImageKHR(_rSolDevice.GetDevice(), 
+                                                      _swapchain,
+                                                      _timeoutDuration, 
+                                                      _imageAvailableSemaphores.at(frameIndex),   // Must be a non-signaled semaphore
+                                                      VK_NULL_HANDLE, 
+                                                      pImageIndex);
 
         return result;
     }
 
-    VkResult SolSwapchain::SubmitCommandBuffers(const VkCommandBuffer *pCommandBuffers, 
-                                                      const uint32_t *pImageIndex)
+    VkResult SolSwapchain::SubmitCommandBuffers(const size_t frameIndex,
+                                                const VkCommandBuffer *pCommandBuffers, 
+                                                const uint32_t *pImageIndex)
     {
         const VkDevice &device  = _rSolDevice.GetDevice();
         VkFence &rInFlightImage = _inFlightImages.at(*pImageIndex);
-        VkFence &rInFlightFence = _inFlightFences.at(_currentFrame);
+        VkFence &rInFlightFence = _inFlightFences.at(frameIndex);
 
+        // With more frames in flight than images, another frame may still be rendering to this image
         if (rInFlightImage != VK_NULL_HANDLE)
         {
-            vkWaitForFences(device, 
-                            1,
-                            &rInFlightImage, 
-                            VK_TRUE, 
-                            _timeoutDuration);
+            WaitForFence(rInFlightImage);
         }
 
         rInFlightImage = rInFlightFence;
 
-        const VkSemaphore          waitSemaphores[]  { _imageAvailableSemaphores.at(_currentFrame) };
+        const VkSemaphore          waitSemaphores[]  { _imageAvailableSemaphores.at(frameIndex) };
         const VkPipelineStageFlags waitStageFlags[]  { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-        const VkSemaphore          signalSemaphores[]{ _renderFinishedSemaphores.at(_currentFrame) };
+        const VkSemaphore          signalSemaphores[]{ _renderFinishedSemaphores.at(frameIndex) };
         const VkSwapchainKHR       swapChains[]      { _swapchain };
 
         const VkSubmitInfo submitInfo
@@ -637,12 +627,26 @@ namespace SolEngine
         result = vkQueuePresentKHR(_rSolDevice.GetPresentQueue(), 
                                    &presentInfo);
 
-        // Flip current frame
-        _currentFrame = (_currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
-
         return result;
     }
 
+    void SolSwapchain::WaitForFence(const VkFence fence)
+    {
+        VkResult result;
+
+        // Keep waiting on a slow frame, but say so instead of hanging silently
+        while ((result = vkWaitForFences(_rSolDevice.GetDevice(),
+                                         1,
+                                         &fence,
+                                         VK_TRUE,
+                                         FENCE_TIMEOUT_DURATION)) == VK_TIMEOUT)
+        {
+            printf_s("Frame still in flight after %llums, waiting...\n", FENCE_TIMEOUT_DURATION / 1'000'000);
+        }
+
+        DBG_ASSERT_VULKAN_MSG(result, "Wait For Fences Failed.");
+    }
+
     bool SolSwapchain::CompareSwapchanFormats(const SolSwapchain& swapchain) const
     {
         // When a swapchain is re-created, these values may change.
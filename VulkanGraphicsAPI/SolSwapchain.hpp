@@ -12,7 +12,9 @@ namespace SolEngine
         SolSwapchain(SolDevice& rSolDevice, const VkExtent2D& windowExtent, std::shared_ptr<SolSwapchain> pOldSwapchain);
         ~SolSwapchain();
 
-        static constexpr uint32_t MAX_FRAMES_IN_FLIGHT{ 2 };
+        // Sync objects are created for the maximum, the Renderer decides how many are actually used
+        static constexpr uint32_t MIN_FRAMES_IN_FLIGHT{ 1 };
+        static constexpr uint32_t MAX_FRAMES_IN_FLIGHT{ 4 };
 
         // Public Accessors
         VkFramebuffer GetFramebuffer(const size_t index) const { return _swapchainFrameBuffers.at(index); }
@@ -26,8 +28,14 @@ namespace SolEngine
 
         VkFormat FindDepthFormat();
 
-        VkResult AcquireNextImage(uint32_t* pImageIndex);
-        VkResult SubmitCommandBuffers(const VkCommandBuffer* pCommandBuffers, const uint32_t* pImageIndex);
+        /// <summary>
+        /// Blocks until the GPU has finished the last submission made with this frame's sync objects.
+        /// </summary>
+        /// <param name="frameIndex"></param>
+        void WaitForFrame(const size_t frameIndex);
+
+        VkResult AcquireNextImage(const size_t frameIndex, uint32_t* pImageIndex);
+        VkResult SubmitCommandBuffers(const size_t frameIndex, const VkCommandBuffer* pCommandBuffers, const uint32_t* pImageIndex);
 
         bool CompareSwapchanFormats(const SolSwapchain& swapchain) const;
 
@@ -42,6 +50,8 @@ namespace SolEngine
         void CreateFramebuffers();
         void CreateSyncObjects();
 
+        void WaitForFence(const VkFence fence);
+
         VkSurfaceFormatKHR ChooseImageFormat(const std::vector<VkSurfaceFormatKHR>& availableFormats);
         VkPresentModeKHR   ChoosePresentMode(const std::vector<VkPresentModeKHR>& availablePresentModes);
         VkExtent2D         ChooseSwapchainExtent(const VkSurfaceCapabilitiesKHR& capabilities);
@@ -63,9 +73,9 @@ namespace SolEngine
         VkRenderPass _renderPass{ NULL };
 
         // Depth
-        std::vector<VkImage>        _depthImages;
-        std::vector<VkImageView>    _depthImageViews;
-        std::vector<VkDeviceMemory> _depthImageMemories;
+        std::vector<VkImage>          _depthImages;
+        std::vector<VkImageView>      _depthImageViews;
+        std::vector<MemoryAllocation> _depthImageMemories;
 
         std::vector<VkFormat> _depthFormatCandidates
         {
@@ -83,7 +93,8 @@ namespace SolEngine
         std::vector<VkFence>     _inFlightFences;
         std::vector<VkFence>     _inFlightImages;
 
-        size_t   _currentFrame   { 0 };
+        static constexpr uint64_t FENCE_TIMEOUT_DURATION{ 1'000'000'000 };    // Nanoseconds, a frame this late is reported rather than waited on silently
+
         uint64_t _timeoutDuration{ (std::numeric_limits<uint64_t>::max)() };
     };
 }
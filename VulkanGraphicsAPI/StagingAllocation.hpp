@@ -0,0 +1,12 @@
+#pragma once
+#include <vulkan/vulkan.hpp>
+
+namespace SolEngine::Data
+{
+    struct StagingAllocation
+    {
+        VkBuffer     buffer      { VK_NULL_HANDLE };
+        VkDeviceSize offset      { 0 };
+        void*        pMappedData { nullptr };    // Already offset, write straight into it
+    };
+}
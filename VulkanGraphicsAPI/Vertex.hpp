@@ -2,19 +2,40 @@
 #include <vulkan/vulkan.hpp>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_precision.hpp>
 
 namespace SolEngine::Data
 {
+	/// <summary>
+	/// Packed into 16 bytes, rather than three glm::vec3's.
+	/// Positions are SNORM 16-bit, colours UNORM 8-bit and normals SNORM 8-bit, so the shader still reads them as vec3's.
+	/// </summary>
 	struct Vertex
 	{
+		static constexpr float POSITION_QUANTISATION		 { 256.f };	// Keeps edge midpoints exact and interpolated positions to 1/256th, the grid's +/-64 still fits
+		static constexpr float POSITION_DEQUANTISATION_SCALE{ 32767.f / POSITION_QUANTISATION };
+		static constexpr float COLOUR_QUANTISATION			 { 255.f };
+		static constexpr float NORMAL_QUANTISATION			 { 127.f };
+
 		Vertex() = default;
 
 		Vertex(const glm::vec3& pos, 
-			   const glm::vec3& col)
-			: position(pos),
-			  colour(col)
+			   const glm::vec3& col,
+			   const glm::vec3& norm = glm::vec3(0.f))
+			: position(glm::round(pos * POSITION_QUANTISATION), 0),
+			  colour(glm::round(col * COLOUR_QUANTISATION), COLOUR_QUANTISATION),
+			  normal(glm::round(norm * NORMAL_QUANTISATION), 0)
 		{}
 
+		/// <summary>
+		/// Scales the SNORM positions back into model space, goes on the end of the model matrix.
+		/// </summary>
+		static glm::mat4 PositionDequantisationMatrix()
+		{
+			return glm::scale(glm::mat4(1.f), 
+							  glm::vec3(POSITION_DEQUANTISATION_SCALE));
+		}
+
 		static std::vector<VkVertexInputBindingDescription> InputBindingDescriptors()
 		{
 			std::vector<VkVertexInputBindingDescription> vertexInputBindingDescriptions(1);
@@ -34,7 +55,7 @@ namespace SolEngine::Data
 
 		static std::vector<VkVertexInputAttributeDescription> InputAttributeDescriptions()
 		{
-			std::vector<VkVertexInputAttributeDescription> vertexInputAttributeDescriptions(2);
+			std::vector<VkVertexInputAttributeDescription> vertexInputAttributeDescriptions(3);
 
 			vertexInputAttributeDescriptions =
 			{
@@ -42,22 +63,30 @@ namespace SolEngine::Data
 				{
 					.location = 0,
 					.binding  = 0,
-					.format   = VK_FORMAT_R32G32B32_SFLOAT,	// X, Y, Z
+					.format   = VK_FORMAT_R16G16B16A16_SNORM,	// X, Y, Z, (Padding)
 					.offset   = offsetof(Vertex, position)
 				},
 				VkVertexInputAttributeDescription	// Colour
 				{
 					.location = 1,
 					.binding  = 0,
-					.format   = VK_FORMAT_R32G32B32_SFLOAT,	// R, G, B
+					.format   = VK_FORMAT_R8G8B8A8_UNORM,		// R, G, B, (A)
 					.offset   = offsetof(Vertex, colour)
+				},
+				VkVertexInputAttributeDescription	// Normal (Unused by SimpleShader)
+				{
+					.location = 2,
+					.binding  = 0,
+					.format   = VK_FORMAT_R8G8B8A8_SNORM,		// X, Y, Z, (Padding)
+					.offset   = offsetof(Vertex, normal)
 				}
 			};
 
 			return vertexInputAttributeDescriptions;
 		}
 
-		glm::vec3 position{ 0, 0, 0 };
-		glm::vec3 colour{ 1.f, 1.f, 1.f };
+		glm::i16vec4 position{ 0, 0, 0, 0 };
+		glm::u8vec4  colour{ 255, 255, 255, 255 };
+		glm::i8vec4  normal{ 0, 0, 0, 0 };
 	};
 }
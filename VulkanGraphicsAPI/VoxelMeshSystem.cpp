@@ -0,0 +1,310 @@
+#include <algorithm>
+
+#include "VoxelMeshSystem.hpp"
+
+namespace SolEngine::System
+{
+    VoxelMeshSystem::VoxelMeshSystem(SolDevice& rSolDevice, 
+                                     SolRenderer& rSolRenderer,
+                                     SolGrid& rSolGrid,
+                                     DiagnosticData& rDiagnosticData)
+        : _rSolDevice(rSolDevice),
+          _rSolRenderer(rSolRenderer),
+          _rSolGrid(rSolGrid),
+          _rDiagnosticData(rDiagnosticData),
+          _voxelMeshObject(SolGameObject::CreateGameObject())
+    {}
+
+    void VoxelMeshSystem::Mesh()
+    {
+        // Start back at the beginning of the array
+        // To re-use vertices.
+        _verticesInUseCount = 0U;
+
+        const glm::uvec3 gridDimensions = _rSolGrid.GetDimensions();
+
+        _chunks.clear();
+
+        // Faces are merged within a chunk, so each chunk's vertices are contiguous and can be culled on their own
+        const glm::uvec3 chunkCounts = (gridDimensions + CHUNK_CELLS_PER_AXIS - 1U) / CHUNK_CELLS_PER_AXIS;
+
+        for (uint32_t zChunk(0U); zChunk < chunkCounts.z; ++zChunk)
+        {
+            for (uint32_t yChunk(0U); yChunk < chunkCounts.y; ++yChunk)
+            {
+                for (uint32_t xChunk(0U); xChunk < chunkCounts.x; ++xChunk)
+                {
+                    const glm::uvec3 minCellIndices = glm::uvec3(xChunk, yChunk, zChunk) * CHUNK_CELLS_PER_AXIS;
+                    const glm::uvec3 maxCellIndices = glm::min(minCellIndices + CHUNK_CELLS_PER_AXIS, gridDimensions);
+
+                    const size_t firstVertex = _verticesInUseCount;
+
+                    _chunkMinBounds = glm::vec3( FLT_MAX);
+                    _chunkMaxBounds = glm::vec3(-FLT_MAX);
+
+                    // Every axis has faces pointing both ways
+                    for (uint32_t axis(0U); axis < AXIS_COUNT; ++axis)
+                    {
+                        for (const int faceDirection : { -1, 1 })
+                        {
+                            for (uint32_t sliceIndex(minCellIndices[axis]); sliceIndex < maxCellIndices[axis]; ++sliceIndex)
+                            {
+                                MeshSlice(axis, 
+                                          faceDirection, 
+                                          sliceIndex, 
+                                          minCellIndices, 
+                                          maxCellIndices);
+                            }
+                        }
+                    }
+
+                    if (_verticesInUseCount == firstVertex)
+                    {
+                        continue;
+                    }
+
+                    _chunks.push_back(MeshChunk
+                    {
+                        .firstVertices = { (uint32_t)firstVertex },
+                        .vertexCounts  = { (uint32_t)(_verticesInUseCount - firstVertex) },
+                        .minBounds     = _chunkMinBounds,
+                        .maxBounds     = _chunkMaxBounds
+                    });
+                }
+            }
+        }
+
+        UpdateGameObjectModel();
+
+        // Update Diagnostic Data
+        const size_t vertexSizeBytes = sizeof(Vertex);
+
+        _rDiagnosticData.vertexCount                  = _verticesInUseCount;
+        _rDiagnosticData.triCount                     = _verticesInUseCount / 3U;
+        _rDiagnosticData.verticesMemoryAllocatedBytes = _vertices.size() * vertexSizeBytes;
+        _rDiagnosticData.verticesMemoryUsedBytes      = _verticesInUseCount * vertexSizeBytes;
+    }
+
+    void VoxelMeshSystem::MeshSlice(const uint32_t axis, 
+                                    const int faceDirection, 
+                                    const uint32_t sliceIndex, 
+                                    const glm::uvec3& minCellIndices, 
+                                    const glm::uvec3& maxCellIndices)
+    {
+        // The two axes the slice lies across
+        const uint32_t uAxis = (axis + 1U) % AXIS_COUNT;
+        const uint32_t vAxis = (axis + 2U) % AXIS_COUNT;
+
+        const uint32_t uCount = maxCellIndices[uAxis] - minCellIndices[uAxis];
+        const uint32_t vCount = maxCellIndices[vAxis] - minCellIndices[vAxis];
+
+        _faceMask.assign((size_t)uCount * vCount, 0U);
+
+        glm::ivec3 cellIndices(0);
+        cellIndices[axis] = (int)sliceIndex;
+
+        bool isAnyFaceExposed(false);
+
+        for (uint32_t v(0U); v < vCount; ++v)
+        {
+            for (uint32_t u(0U); u < uCount; ++u)
+            {
+                cellIndices[uAxis] = (int)(minCellIndices[uAxis] + u);
+                cellIndices[vAxis] = (int)(minCellIndices[vAxis] + v);
+
+                glm::ivec3 neighbourIndices = cellIndices;
+                neighbourIndices[axis] += faceDirection;
+
+                // Only faces between a live cell and a dead one (or the edge of the grid) can be seen
+                const bool isFaceExposed = IsCellAlive(cellIndices) && !IsCellAlive(neighbourIndices);
+
+                _faceMask.at((size_t)v * uCount + u) = isFaceExposed;
+                isAnyFaceExposed |= isFaceExposed;
+            }
+        }
+
+        if (!isAnyFaceExposed)
+        {
+            return;
+        }
+
+        for (uint32_t v(0U); v < vCount; ++v)
+        {
+            uint8_t* pMaskRow = &_faceMask.at((size_t)v * uCount);
+
+            for (uint32_t u(0U); u < uCount;)
+            {
+                if (!pMaskRow[u])
+                {
+                    ++u;
+                    continue;
+                }
+
+                // Grow the face along u as far as it goes...
+                uint32_t width(1U);
+
+                while (u + width < uCount && pMaskRow[u + width])
+                {
+                    ++width;
+                }
+
+                // ...then along v, for as long as the whole width is exposed
+                uint32_t height(1U);
+
+                while (v + height < vCount)
+                {
+                    const uint8_t* pNextMaskRow = pMaskRow + (size_t)height * uCount;
+
+                    if (std::find(pNextMaskRow + u, pNextMaskRow + u + width, 0U) != pNextMaskRow + u + width)
+                    {
+                        break;
+                    }
+
+                    ++height;
+                }
+
+                // Merged faces can't start another quad
+                for (uint32_t h(0U); h < height; ++h)
+                {
+                    std::fill_n(pMaskRow + (size_t)h * uCount + u, width, 0U);
+                }
+
+                cellIndices[uAxis] = (int)(minCellIndices[uAxis] + u);
+                cellIndices[vAxis] = (int)(minCellIndices[vAxis] + v);
+
+                CreateQuad(axis, 
+                           faceDirection, 
+                           cellIndices, 
+                           width, 
+                           height);
+
+                u += width;
+            }
+        }
+    }
+
+    void VoxelMeshSystem::CreateQuad(const uint32_t axis, 
+                                     const int faceDirection, 
+                                     const glm::ivec3& firstCellIndices, 
+                                     const uint32_t width, 
+                                     const uint32_t height)
+    {
+        const uint32_t uAxis = (axis + 1U) % AXIS_COUNT;
+        const uint32_t vAxis = (axis + 2U) % AXIS_COUNT;
+
+        // Cells are unit cubes centred on their indices, the same spacing marching cubes samples them at
+        glm::vec3 quadOrigin = glm::vec3(firstCellIndices) - 0.5f;
+        quadOrigin[axis] += (faceDirection > 0) ? 1.f : 0.f;
+
+        glm::vec3 uEdge(0.f);
+        glm::vec3 vEdge(0.f);
+        uEdge[uAxis] = (float)width;
+        vEdge[vAxis] = (float)height;
+
+        const glm::vec3 gridCorners[4]
+        {
+            quadOrigin,
+            quadOrigin + uEdge,
+            quadOrigin + uEdge + vEdge,
+            quadOrigin + vEdge
+        };
+
+        const glm::vec3 gridDimensions = _rSolGrid.GetDimensions();
+
+        // Out of the live cell, which is also the face's normal
+        glm::vec3 exposedDirection(0.f);
+        exposedDirection[axis] = (float)faceDirection;
+
+        const glm::vec3 exposedModelDirection = GridToModelSpace(exposedDirection) - GridToModelSpace(glm::vec3(0.f));
+
+        Vertex    quadVertices[4];
+        glm::vec3 modelCorners[4];
+
+        for (uint32_t i(0U); i < 4U; ++i)
+        {
+            modelCorners[i] = GridToModelSpace(gridCorners[i]);
+            quadVertices[i] = Vertex(modelCorners[i], 
+                                     glm::clamp(gridCorners[i] / gridDimensions, 0.f, 1.f),
+                                     exposedModelDirection);
+        }
+
+        // Wound like the marching cubes mesh, with (b - a) x (c - a) pointing into the live cell
+        const glm::vec3 windingDirection = glm::cross(modelCorners[1] - modelCorners[0], 
+                                                      modelCorners[2] - modelCorners[0]);
+
+        static constexpr uint32_t WOUND_INDICES[QUAD_VERTEX_COUNT]   { 0U, 1U, 2U, 0U, 2U, 3U };
+        static constexpr uint32_t REWOUND_INDICES[QUAD_VERTEX_COUNT] { 0U, 2U, 1U, 0U, 3U, 2U };
+
+        const uint32_t* pIndices = (glm::dot(windingDirection, exposedModelDirection) > 0.f) ? REWOUND_INDICES 
+                                                                                              : WOUND_INDICES;
+
+        for (uint32_t i(0U); i < QUAD_VERTEX_COUNT; ++i)
+        {
+            AddVertex(quadVertices[pIndices[i]]);
+        }
+
+        _chunkMinBounds = glm::min(_chunkMinBounds, glm::min(modelCorners[0], modelCorners[2]));
+        _chunkMaxBounds = glm::max(_chunkMaxBounds, glm::max(modelCorners[0], modelCorners[2]));
+    }
+
+    void VoxelMeshSystem::AddVertex(const Vertex& vertex)
+    {
+        if (_verticesInUseCount < _vertices.size())
+        {
+            // Re-use initialised vertices...
+            _vertices.at(_verticesInUseCount) = vertex;
+        }
+        else
+        {
+            // Expand storage if necessary...
+            _vertices.push_back(vertex);
+        }
+
+        ++_verticesInUseCount;
+    }
+
+    bool VoxelMeshSystem::IsCellAlive(const glm::ivec3& cellIndices) const
+    {
+        const int index = _3DTo1DIndex(cellIndices.x, 
+                                       cellIndices.y, 
+                                       cellIndices.z, 
+                                       _rSolGrid.GetDimensions());
+
+        // Outside the grid counts as dead
+        return index >= 0 && _rSolGrid.cells.pCellStates[index];
+    }
+
+    glm::vec3 VoxelMeshSystem::GridToModelSpace(const glm::vec3& gridPosition) const
+    {
+        const glm::ivec3& gridMinBounds = _rSolGrid.GetMinBounds();
+
+        // The grid's y-axis runs downwards from its min bounds
+        return glm::vec3(gridMinBounds.x + gridPosition.x,
+                         gridMinBounds.y - gridPosition.y,
+                         gridMinBounds.z + gridPosition.z);
+    }
+
+    void VoxelMeshSystem::UpdateGameObjectModel()
+    {
+        // Frames still in flight may be drawing the previous model
+        _rSolRenderer.DeferRelease(_voxelMeshObject.GetModel());
+
+        // An empty grid draws nothing, rather than the last mesh that had faces
+        if (_verticesInUseCount == 0U)
+        {
+            _voxelMeshObject.SetModel(nullptr);
+
+            return;
+        }
+
+        std::shared_ptr<SolModel> pVoxelModel = 
+            std::make_shared<SolModel>(_rSolDevice, 
+                                       _rSolRenderer,
+                                       _vertices.data(), 
+                                       (uint32_t)_verticesInUseCount);
+
+        pVoxelModel->SetChunks(_chunks);
+
+        _voxelMeshObject.SetModel(pVoxelModel);
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <cfloat>
+
+#include "SolGrid.hpp"
+#include "SolGameObject.hpp"
+#include "SolRenderer.hpp"
+
+namespace SolEngine::System
+{
+	/// <summary>
+	/// Meshes live cells as blocks, only emitting the faces next to dead cells and 
+	/// greedily merging coplanar faces into larger quads.
+	/// </summary>
+	class VoxelMeshSystem
+	{
+	public:
+		VoxelMeshSystem(SolDevice& rSolDevice, SolRenderer& rSolRenderer, SolGrid& rSolGrid, DiagnosticData& rDiagnosticData);
+
+		SolGameObject& GetGameObject() { return _voxelMeshObject; }
+
+		void Mesh();
+		void ResetVerticesContainerSize() { _vertices.clear(); }
+
+	private:
+		static constexpr uint32_t AXIS_COUNT		  { 3U };
+		static constexpr uint32_t CHUNK_CELLS_PER_AXIS{ 16U };	// Matches MarchingCubesSystem, so chunks cull the same
+		static constexpr uint32_t QUAD_VERTEX_COUNT	  { 6U };	// 2 Triangles, nothing is indexed
+
+		/// <summary>
+		/// Meshes the faces pointing faceDirection along axis, for one slice of cells inside the chunk.
+		/// </summary>
+		void MeshSlice(const uint32_t axis, const int faceDirection, const uint32_t sliceIndex, 
+					   const glm::uvec3& minCellIndices, const glm::uvec3& maxCellIndices);
+		void CreateQuad(const uint32_t axis, const int faceDirection, const glm::ivec3& firstCellIndices, 
+						const uint32_t width, const uint32_t height);
+		void AddVertex(const Vertex& vertex);
+
+		bool	  IsCellAlive(const glm::ivec3& cellIndices) const;
+		glm::vec3 GridToModelSpace(const glm::vec3& gridPosition) const;
+
+		void UpdateGameObjectModel();
+
+		SolDevice&		_rSolDevice;
+		SolRenderer&	_rSolRenderer;
+		SolGrid&		_rSolGrid;
+		DiagnosticData& _rDiagnosticData;
+		SolGameObject	_voxelMeshObject;
+
+		size_t				_verticesInUseCount{ 0U };
+		std::vector<Vertex> _vertices		   {};
+
+		std::vector<uint8_t> _faceMask{};	// Exposed faces of the slice being meshed, cleared as they're merged
+
+		std::vector<MeshChunk> _chunks		  {};
+		glm::vec3			   _chunkMinBounds{ 0.f };	// Of the chunk being meshed
+		glm::vec3			   _chunkMaxBounds{ 0.f };
+	};
+}
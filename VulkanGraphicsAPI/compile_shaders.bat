@@ -1,5 +1,9 @@
 E:\VulkanSDK\1.2.189.2\Bin32\glslc.exe Shaders\SimpleShader.vert -o Shaders\SimpleShader.vert.spv
 E:\VulkanSDK\1.2.189.2\Bin32\glslc.exe Shaders\SimpleShader.frag -o Shaders\SimpleShader.frag.spv
+E:\VulkanSDK\1.2.189.2\Bin32\glslc.exe Shaders\LitShader.vert -o Shaders\LitShader.vert.spv
+E:\VulkanSDK\1.2.189.2\Bin32\glslc.exe Shaders\GameOfLife.comp -o Shaders\GameOfLife.comp.spv
+E:\VulkanSDK\1.2.189.2\Bin32\glslc.exe Shaders\MarchingCubes.comp -o Shaders\MarchingCubes.comp.spv
+E:\VulkanSDK\1.2.189.2\Bin32\glslc.exe Shaders\CubeInstanceShader.vert -o Shaders\CubeInstanceShader.vert.spv
 
 echo "Shader .spv file(s) created successfully!"
 pause
\ No newline at end of file
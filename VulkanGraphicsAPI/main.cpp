@@ -1,7 +1,14 @@
+#include <cstring>
+
 #include "Application.hpp"
 
-int main()
+static constexpr const char* COMPUTE_SELF_TEST_ARG{ "--compute-self-test" };    // Runs the GPU Compute self test, then exits
+
+int main(int argc, char* argv[])
 {
+	const bool isComputeSelfTestRequested = (argc > 1) && 
+											(std::strcmp(argv[1], COMPUTE_SELF_TEST_ARG) == 0);
+
 	const ApplicationData appData
 	{
 		.windowTitle	  = "[13/04/22] Marching Cubes Cellular Automata",
@@ -14,6 +21,7 @@ int main()
 	GridSettings       gridSettings		 {};
 	GameOfLifeSettings gameOfLifeSettings{};
 	SimulationSettings simulationSettings{};
+	RecordingSettings  recordingSettings {};
 
 #ifdef LAPTOP_BUILD
 	simulationSettings.state = SimulationState::PLAY;
@@ -26,10 +34,17 @@ int main()
 							cameraSettings,
 							gridSettings,
 							gameOfLifeSettings,
-							simulationSettings);
+							simulationSettings,
+							recordingSettings);
 
 	try
 	{
+		if (isComputeSelfTestRequested)
+		{
+			return application.RunComputeSelfTest() ? EXIT_SUCCESS 
+													: EXIT_FAILURE;
+		}
+
 		application.Run();
 	}
 	catch (const std::exception& e)